@@ -50,7 +50,10 @@ typedef enum {
   // number of V-cycles
   NUM_VCYCLES,
   // disables or enables logging
-  VERBOSE
+  VERBOSE,
+  // if set to 1, community detection is skipped and the community IDs set via
+  // mt_kahypar_set_(hyper)graph_community_ids(...) are used instead
+  USE_PRECOMPUTED_COMMUNITIES
 } mt_kahypar_context_parameter_type_t;
 
 /**
@@ -219,6 +222,26 @@ MT_KAHYPAR_API mt_kahypar_hypernode_id_t mt_kahypar_num_pins(mt_kahypar_hypergra
 MT_KAHYPAR_API mt_kahypar_hypernode_id_t mt_kahypar_hypergraph_weight(mt_kahypar_hypergraph_t* hypergraph);
 MT_KAHYPAR_API mt_kahypar_hypernode_id_t mt_kahypar_graph_weight(mt_kahypar_graph_t* graph);
 
+/**
+ * Sets the community ID of each node of the (hyper)graph. Contractions are restricted to nodes
+ * within the same community. The community IDs are only used for partitioning if the context
+ * parameter USE_PRECOMPUTED_COMMUNITIES is set (otherwise, they are recomputed).
+ */
+MT_KAHYPAR_API void mt_kahypar_set_hypergraph_community_ids(mt_kahypar_hypergraph_t* hypergraph,
+                                                            const mt_kahypar_partition_id_t* community_ids);
+MT_KAHYPAR_API void mt_kahypar_set_graph_community_ids(mt_kahypar_graph_t* graph,
+                                                       const mt_kahypar_partition_id_t* community_ids);
+
+/**
+ * Extracts the community ID of each node of the (hyper)graph. After a partitioning call,
+ * these are the communities computed during preprocessing, which can be stored and passed
+ * to subsequent runs on the same input to skip community detection.
+ */
+MT_KAHYPAR_API void mt_kahypar_get_hypergraph_community_ids(const mt_kahypar_hypergraph_t* hypergraph,
+                                                            mt_kahypar_partition_id_t* community_ids);
+MT_KAHYPAR_API void mt_kahypar_get_graph_community_ids(const mt_kahypar_graph_t* graph,
+                                                       mt_kahypar_partition_id_t* community_ids);
+
 // ####################### Partition #######################
 
 /**
@@ -81,6 +81,20 @@ MT_KAHYPAR_API mt_kahypar_hyperedge_id_t mt_kahypar_num_edges(mt_kahypar_graph_t
  */
 MT_KAHYPAR_API mt_kahypar_hypernode_id_t mt_kahypar_total_weight(mt_kahypar_graph_t* graph);
 
+/**
+ * Sets the community ID of each node of the graph. Contractions are restricted to nodes
+ * within the same community. The community IDs are only used for partitioning if the context
+ * parameter USE_PRECOMPUTED_COMMUNITIES is set (otherwise, they are recomputed).
+ */
+MT_KAHYPAR_API void mt_kahypar_set_community_ids(mt_kahypar_graph_t* graph,
+                                                 const mt_kahypar_partition_id_t* community_ids);
+
+/**
+ * Extracts the community ID of each node of the graph (e.g., computed by a previous partitioning call).
+ */
+MT_KAHYPAR_API void mt_kahypar_get_community_ids(const mt_kahypar_graph_t* graph,
+                                                 mt_kahypar_partition_id_t* community_ids);
+
 // ####################### Partition #######################
 
 /**
@@ -89,6 +103,9 @@ MT_KAHYPAR_API mt_kahypar_hypernode_id_t mt_kahypar_total_weight(mt_kahypar_grap
  * \note Before partitioning, the number of blocks, imbalance parameter and objective function must be
  *       set in the partitioning context. This can be done either via mt_kahypar_set_context_parameter(...)
  *       or mt_kahypar_set_partitioning_parameters(...).
+ * \note If a node ordering is configured (p-node-ordering), the input graph is released while a relabeled
+ *       copy of it is partitioned and rebuilt afterwards. It keeps its IDs and weights, but pointers into its
+ *       internal data obtained before the call are invalidated.
  */
 MT_KAHYPAR_API mt_kahypar_partitioned_graph_t* mt_kahypar_partition(mt_kahypar_graph_t* graph,
                                                                     mt_kahypar_context_t* context);
@@ -106,6 +106,9 @@ int mt_kahypar_set_context_parameter(mt_kahypar_context_t* context,
     case VERBOSE:
       c.partition.verbose_output = atoi(value);
       return 0;
+    case USE_PRECOMPUTED_COMMUNITIES:
+      c.preprocessing.use_precomputed_communities = atoi(value);
+      return 0;
   }
   return 1; /** no valid parameter type **/
 }
@@ -224,6 +227,26 @@ mt_kahypar_hypernode_id_t mt_kahypar_graph_weight(mt_kahypar_graph_t* graph) {
   return gp::mt_kahypar_total_weight(graph);
 }
 
+void mt_kahypar_set_hypergraph_community_ids(mt_kahypar_hypergraph_t* hypergraph,
+                                             const mt_kahypar_partition_id_t* community_ids) {
+  hgp::mt_kahypar_set_community_ids(hypergraph, community_ids);
+}
+
+void mt_kahypar_set_graph_community_ids(mt_kahypar_graph_t* graph,
+                                        const mt_kahypar_partition_id_t* community_ids) {
+  gp::mt_kahypar_set_community_ids(graph, community_ids);
+}
+
+void mt_kahypar_get_hypergraph_community_ids(const mt_kahypar_hypergraph_t* hypergraph,
+                                             mt_kahypar_partition_id_t* community_ids) {
+  hgp::mt_kahypar_get_community_ids(hypergraph, community_ids);
+}
+
+void mt_kahypar_get_graph_community_ids(const mt_kahypar_graph_t* graph,
+                                        mt_kahypar_partition_id_t* community_ids) {
+  gp::mt_kahypar_get_community_ids(graph, community_ids);
+}
+
 void mt_kahypar_free_partitioned_hypergraph(mt_kahypar_partitioned_hypergraph_t* partitioned_hg) {
   hgp::mt_kahypar_free_partitioned_hypergraph(partitioned_hg);
 }
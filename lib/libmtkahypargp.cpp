@@ -108,6 +108,26 @@ mt_kahypar_hypernode_id_t mt_kahypar_total_weight(mt_kahypar_graph_t* graph) {
   return reinterpret_cast<Graph*>(graph)->totalWeight();
 }
 
+void mt_kahypar_set_community_ids(mt_kahypar_graph_t* graph,
+                                  const mt_kahypar_partition_id_t* community_ids) {
+  ASSERT(community_ids != nullptr);
+  Graph& g = *reinterpret_cast<Graph*>(graph);
+  mt_kahypar::ds::Clustering communities(g.initialNumNodes());
+  tbb::parallel_for(ID(0), g.initialNumNodes(), [&](const mt_kahypar::HypernodeID& hn) {
+    communities[hn] = community_ids[hn];
+  });
+  g.setCommunityIDs(std::move(communities));
+}
+
+void mt_kahypar_get_community_ids(const mt_kahypar_graph_t* graph,
+                                  mt_kahypar_partition_id_t* community_ids) {
+  ASSERT(community_ids != nullptr);
+  const Graph& g = *reinterpret_cast<const Graph*>(graph);
+  tbb::parallel_for(ID(0), g.initialNumNodes(), [&](const mt_kahypar::HypernodeID& hn) {
+    community_ids[hn] = g.communityID(hn);
+  });
+}
+
 void mt_kahypar_free_partitioned_graph(mt_kahypar_partitioned_graph_t* partitioned_graph) {
   if (partitioned_graph == nullptr) {
     return;
@@ -111,6 +111,26 @@ mt_kahypar_hypernode_id_t mt_kahypar_total_weight(mt_kahypar_hypergraph_t* hyper
   return reinterpret_cast<mt_kahypar::Hypergraph*>(hypergraph)->totalWeight();
 }
 
+void mt_kahypar_set_community_ids(mt_kahypar_hypergraph_t* hypergraph,
+                                  const mt_kahypar_partition_id_t* community_ids) {
+  ASSERT(community_ids != nullptr);
+  mt_kahypar::Hypergraph& hg = *reinterpret_cast<mt_kahypar::Hypergraph*>(hypergraph);
+  mt_kahypar::ds::Clustering communities(hg.initialNumNodes());
+  tbb::parallel_for(ID(0), hg.initialNumNodes(), [&](const mt_kahypar::HypernodeID& hn) {
+    communities[hn] = community_ids[hn];
+  });
+  hg.setCommunityIDs(std::move(communities));
+}
+
+void mt_kahypar_get_community_ids(const mt_kahypar_hypergraph_t* hypergraph,
+                                  mt_kahypar_partition_id_t* community_ids) {
+  ASSERT(community_ids != nullptr);
+  const mt_kahypar::Hypergraph& hg = *reinterpret_cast<const mt_kahypar::Hypergraph*>(hypergraph);
+  tbb::parallel_for(ID(0), hg.initialNumNodes(), [&](const mt_kahypar::HypernodeID& hn) {
+    community_ids[hn] = hg.communityID(hn);
+  });
+}
+
 void mt_kahypar_free_partitioned_hypergraph(mt_kahypar_partitioned_hypergraph_t* partitioned_hg) {
   if (partitioned_hg == nullptr) {
     return;
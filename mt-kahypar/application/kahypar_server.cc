@@ -0,0 +1,79 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2019 Lars Gottesbüren <lars.gottesbueren@kit.edu>
+ * Copyright (C) 2019 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+// Long-running partitioning service that answers requests read from stdin
+// on stdout (see partitioning_server.h for the protocol).
+
+#include <iostream>
+#include <thread>
+
+#include <boost/program_options.hpp>
+
+#include "mt-kahypar/application/partitioning_server.h"
+
+namespace po = boost::program_options;
+
+int main(int argc, char* argv[]) {
+
+  size_t num_threads = std::thread::hardware_concurrency();
+  po::options_description options("Options");
+  options.add_options()
+    ("help", "show help message")
+    ("s-num-threads,t", po::value<size_t>(&num_threads)->value_name("<size_t>"),
+     "Number of threads used by all partition requests");
+  po::variables_map vm;
+  po::store(po::parse_command_line(argc, argv, options), vm);
+  if ( vm.count("help") != 0 ) {
+    LOG << options;
+    return 0;
+  }
+  po::notify(vm);
+
+  size_t num_available_cpus = mt_kahypar::HardwareTopology::instance().num_cpus();
+  if ( num_available_cpus < num_threads ) {
+    // stdout is reserved for the responses
+    mt_kahypar::StreamRedirection redirection(std::cout, std::cerr);
+    WARNING("There are currently only" << num_available_cpus << "cpus available."
+      << "Setting number of threads from" << num_threads
+      << "to" << num_available_cpus);
+    num_threads = num_available_cpus;
+  }
+
+  // Initialize TBB task arenas on numa nodes once for all requests
+  mt_kahypar::TBBInitializer::instance(num_threads);
+  hwloc_cpuset_t cpuset = mt_kahypar::TBBInitializer::instance().used_cpuset();
+  mt_kahypar::parallel::HardwareTopology<>::instance().activate_interleaved_membind_policy(cpuset);
+  hwloc_bitmap_free(cpuset);
+
+  mt_kahypar::PartitioningServer server(num_threads);
+  server.run(std::cin, std::cout);
+
+  mt_kahypar::parallel::MemoryPool::instance().free_memory_chunks();
+  mt_kahypar::TBBInitializer::instance().terminate();
+
+  return 0;
+}
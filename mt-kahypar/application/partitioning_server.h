@@ -0,0 +1,405 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2019 Lars Gottesbüren <lars.gottesbueren@kit.edu>
+ * Copyright (C) 2019 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+
+/*
+ * Long-running partitioning service. Hypergraphs are read once and kept
+ * resident together with TBB, the hardware topology and the memory pool.
+ * Requests are read line by line and each request is answered with exactly
+ * one line that starts with 'ok' or 'error':
+ *
+ *   load <name> <file> [hmetis|metis]   reads a hypergraph and caches it under <name>
+ *   partition <name> <options>          partitions the cached hypergraph with the usual
+ *                                       command line options (e.g. -p config/default_preset.ini
+ *                                       -k 8 -e 0.03 -o km1 -m direct --write-partition-file=true)
+ *   unload <name>                       removes a cached hypergraph
+ *   list                                lists all cached hypergraphs
+ *   quit                                terminates the service
+ *
+ * Each partition request works on a copy of the cached hypergraph, since
+ * preprocessing modifies the input. Verbose output is disabled, because
+ * the output stream is used for the responses. All other output of the
+ * library (e.g., warnings) is redirected to stderr while a request is
+ * processed.
+ *
+ * A failing request must not terminate the service. Therefore, requests are
+ * validated before they reach code paths that exit the process on invalid
+ * input (help message, missing files, illegal modes and objectives, enabled
+ * initial partitioning algorithms) and unsupported algorithm combinations are
+ * resolved as in the library interface instead of asking for confirmation on
+ * stdin. Malformed input files and illegal option values are reported with
+ * exceptions, which are answered with an error.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <boost/program_options.hpp>
+
+#include "mt-kahypar/definitions.h"
+#include "mt-kahypar/io/command_line_options.h"
+#include "mt-kahypar/io/hypergraph_io.h"
+#include "mt-kahypar/partition/metrics.h"
+#include "mt-kahypar/partition/partitioner.h"
+#include "mt-kahypar/partition/registries/register_memory_pool.h"
+#include "mt-kahypar/utils/randomize.h"
+#include "mt-kahypar/utils/utilities.h"
+
+namespace mt_kahypar {
+
+// ! Redirects all output written to a stream to another stream for the
+// ! lifetime of the object
+class StreamRedirection {
+ public:
+  StreamRedirection(std::ostream& from, std::ostream& to) :
+    _from(from),
+    _buffer(from.rdbuf(to.rdbuf())) { }
+
+  StreamRedirection(const StreamRedirection&) = delete;
+  StreamRedirection & operator= (const StreamRedirection &) = delete;
+
+  ~StreamRedirection() {
+    _from.rdbuf(_buffer);
+  }
+
+ private:
+  std::ostream& _from;
+  std::streambuf* _buffer;
+};
+
+struct CachedHypergraph {
+  std::string filename;
+  Hypergraph hypergraph;
+};
+
+// ! The memory pool is registered for a specific hypergraph and partitioning
+// ! configuration. If a request uses the same configuration as the previous
+// ! one, the already allocated memory chunks are reused. The signature contains
+// ! all settings that change the chunks registered in register_memory_pool(...).
+struct MemoryPoolSignature {
+  std::string name;
+  PartitionID k = kInvalidPartition;
+  Mode mode = Mode::UNDEFINED;
+  Paradigm paradigm = Paradigm::multilevel;
+  bool use_community_detection = false;
+  bool implicit_star_expansion = false;
+  bool low_memory_contraction = false;
+  FMAlgorithm fm_algorithm = FMAlgorithm::do_nothing;
+  size_t memory_budget = 0;
+
+  static MemoryPoolSignature fromContext(const std::string& name, const Context& context) {
+    MemoryPoolSignature signature;
+    signature.name = name;
+    signature.k = context.partition.k;
+    signature.mode = context.partition.mode;
+    signature.paradigm = context.partition.paradigm;
+    signature.use_community_detection = context.preprocessing.use_community_detection;
+    signature.implicit_star_expansion = context.preprocessing.community_detection.implicit_star_expansion;
+    signature.low_memory_contraction = context.preprocessing.community_detection.low_memory_contraction;
+    // The FM algorithm determines whether a gain cache is allocated and the
+    // memory budget can replace it with gain recomputation
+    signature.fm_algorithm = context.refinement.fm.algorithm;
+    signature.memory_budget = context.shared_memory.memory_budget;
+    return signature;
+  }
+
+  bool operator==(const MemoryPoolSignature& other) const {
+    return name == other.name && k == other.k && mode == other.mode &&
+           paradigm == other.paradigm && use_community_detection == other.use_community_detection &&
+           implicit_star_expansion == other.implicit_star_expansion &&
+           low_memory_contraction == other.low_memory_contraction &&
+           fm_algorithm == other.fm_algorithm && memory_budget == other.memory_budget;
+  }
+};
+
+class PartitioningServer {
+
+  using InvalidRequest = std::invalid_argument;
+
+ public:
+  explicit PartitioningServer(const size_t num_threads) :
+    _num_threads(num_threads),
+    _utility_id(utils::Utilities::instance().registerNewUtilityObjects()),
+    _hypergraphs(),
+    _pool_signature() { }
+
+  // ! Processes requests until 'quit' is received or the input stream is closed
+  void run(std::istream& in, std::ostream& out) {
+    std::string line;
+    while ( std::getline(in, line) ) {
+      std::istringstream request(line);
+      std::vector<std::string> args;
+      std::string arg;
+      while ( request >> arg ) {
+        args.push_back(arg);
+      }
+      if ( args.empty() ) {
+        continue;
+      } else if ( args[0] == "quit" ) {
+        out << "ok bye" << std::endl;
+        break;
+      }
+
+      std::string response;
+      try {
+        // Output of the library must not be interleaved with the responses
+        StreamRedirection redirection(std::cout, std::cerr);
+        response = handleRequest(args);
+      } catch ( const std::exception& e ) {
+        response = std::string("error ") + e.what();
+      }
+      out << response << std::endl;
+    }
+  }
+
+ private:
+  std::string handleRequest(const std::vector<std::string>& args) {
+    const std::string& command = args[0];
+    if ( command == "load" && ( args.size() == 3 || args.size() == 4 ) ) {
+      return load(args[1], args[2], args.size() == 4 ? args[3] : "hmetis");
+    } else if ( command == "partition" && args.size() >= 2 ) {
+      return partition(args[1], std::vector<std::string>(args.begin() + 2, args.end()));
+    } else if ( command == "unload" && args.size() == 2 ) {
+      if ( _hypergraphs.erase(args[1]) == 0 ) {
+        throw InvalidRequest("unknown hypergraph " + args[1]);
+      }
+      if ( _pool_signature.name == args[1] ) {
+        parallel::MemoryPool::instance().free_memory_chunks();
+        _pool_signature = MemoryPoolSignature();
+      }
+      return "ok unloaded " + args[1];
+    } else if ( command == "list" && args.size() == 1 ) {
+      std::stringstream response;
+      response << "ok";
+      for ( const auto& entry : _hypergraphs ) {
+        response << " " << entry.first;
+      }
+      return response.str();
+    }
+    throw InvalidRequest("invalid request '" + command + "'");
+  }
+
+  std::string load(const std::string& name,
+                   const std::string& filename,
+                   const std::string& format) {
+    if ( format != "hmetis" && format != "metis" ) {
+      throw InvalidRequest("unknown file format " + format);
+    }
+    if ( !std::ifstream(filename) ) {
+      throw InvalidRequest("could not open " + filename);
+    }
+    // Incident nets are always constructed in a stable order such that cached
+    // hypergraphs can also serve requests of the deterministic preset.
+    CachedHypergraph cached { filename, io::readInputFile(filename,
+      format == "hmetis" ? FileFormat::hMetis : FileFormat::Metis, true) };
+    std::stringstream response;
+    response << "ok loaded " << name
+             << " nodes=" << cached.hypergraph.initialNumNodes()
+             << " edges=" << cached.hypergraph.initialNumEdges()
+             << " pins=" << cached.hypergraph.initialNumPins();
+    if ( _pool_signature.name == name ) {
+      parallel::MemoryPool::instance().free_memory_chunks();
+      _pool_signature = MemoryPoolSignature();
+    }
+    _hypergraphs.insert_or_assign(name, std::move(cached));
+    return response.str();
+  }
+
+  std::string partition(const std::string& name,
+                        const std::vector<std::string>& options) {
+    auto it = _hypergraphs.find(name);
+    if ( it == _hypergraphs.end() ) {
+      throw InvalidRequest("unknown hypergraph " + name);
+    }
+    const CachedHypergraph& cached = it->second;
+
+    // Parse request options with the same parser as the command line application
+    std::vector<std::string> cmd = { "MtKaHyParServer", "-h", cached.filename };
+    cmd.insert(cmd.end(), options.begin(), options.end());
+    std::vector<char*> argv;
+    for ( std::string& arg : cmd ) {
+      argv.push_back(arg.data());
+    }
+    validateOptions(static_cast<int>(argv.size()), argv.data());
+    Context context(false);
+    processCommandLineInput(context, static_cast<int>(argv.size()), argv.data());
+    context.partition.verbose_output = false;
+    context.shared_memory.num_threads = _num_threads;
+    prepareContext(context, cached.hypergraph);
+    // All requests share the same timer and stats, which are reset for each request
+    context.utility_id = _utility_id;
+    utils::Utilities::instance().getTimer(_utility_id).clear();
+    utils::Utilities::instance().getStats(_utility_id).clear();
+    utils::Randomize::instance().setSeed(context.partition.seed);
+    if ( context.shared_memory.use_localized_random_shuffle ) {
+      utils::Randomize::instance().enableLocalizedParallelShuffle(
+        context.shared_memory.shuffle_block_size);
+    }
+
+    Hypergraph hypergraph = cached.hypergraph.copy(parallel_tag_t());
+    const MemoryPoolSignature signature = MemoryPoolSignature::fromContext(name, context);
+    if ( parallel::MemoryPool::instance().isInitialized() && signature == _pool_signature ) {
+      parallel::MemoryPool::instance().reset();
+    } else {
+      parallel::MemoryPool::instance().free_memory_chunks();
+      register_memory_pool(hypergraph, context);
+      _pool_signature = signature;
+    }
+
+    HighResClockTimepoint start = std::chrono::high_resolution_clock::now();
+    PartitionedHypergraph partitioned_hypergraph = mt_kahypar::partition(hypergraph, context);
+    HighResClockTimepoint end = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double> elapsed_seconds(end - start);
+
+    std::stringstream response;
+    response << "ok partitioned " << name
+             << " k=" << context.partition.k
+             << " epsilon=" << context.partition.epsilon
+             << " km1=" << metrics::km1(partitioned_hypergraph)
+             << " cut=" << metrics::hyperedgeCut(partitioned_hypergraph)
+             << " imbalance=" << metrics::imbalance(partitioned_hypergraph, context)
+             << " time=" << elapsed_seconds.count();
+    if ( context.partition.write_partition_file ) {
+      io::writePartitionFile(partitioned_hypergraph, context.partition.graph_partition_filename);
+      response << " partition_file=" << context.partition.graph_partition_filename;
+    }
+    return response.str();
+  }
+
+  // ! Checks the request options that processCommandLineInput(...) answers by
+  // ! terminating the process. All other options are parsed by the regular
+  // ! command line parser, which reports errors via exceptions.
+  void validateOptions(int argc, char* argv[]) const {
+    namespace po = boost::program_options;
+    size_t num_threads = 0;
+    std::string preset_file;
+    std::string objective;
+    std::string mode;
+    std::string preset_type;
+    po::options_description options;
+    options.add_options()
+      ("help", "")
+      ("s-num-threads,t", po::value<size_t>(&num_threads))
+      ("preset,p", po::value<std::string>(&preset_file))
+      ("objective,o", po::value<std::string>(&objective))
+      ("mode,m", po::value<std::string>(&mode))
+      ("preset-type", po::value<std::string>(&preset_type));
+    po::variables_map vm;
+    po::store(po::command_line_parser(argc, argv).options(options).allow_unregistered().run(), vm);
+    po::notify(vm);
+
+    if ( vm.count("help") != 0 ) {
+      throw InvalidRequest("help is not available for partition requests");
+    }
+    if ( vm.count("s-num-threads") != 0 && num_threads != _num_threads ) {
+      throw InvalidRequest("the number of threads is fixed to " + std::to_string(_num_threads) +
+                           " when the server is started");
+    }
+    if ( vm.count("preset") != 0 && !std::ifstream(preset_file) ) {
+      throw InvalidRequest("could not load context file at " + preset_file);
+    }
+    if ( vm.count("objective") != 0 && objective != "cut" && objective != "km1" ) {
+      throw InvalidRequest("illegal objective " + objective);
+    }
+    if ( vm.count("mode") != 0 && mode != "direct" && mode != "rb" && mode != "deep" ) {
+      throw InvalidRequest("illegal mode " + mode);
+    }
+    if ( vm.count("preset-type") != 0 && preset_type != "deterministic" && preset_type != "default" &&
+         preset_type != "default_flows" && preset_type != "quality" && preset_type != "quality_flows" ) {
+      throw InvalidRequest("illegal preset type " + preset_type);
+    }
+  }
+
+  // ! Context::sanityCheck() asks on stdin whether an unsupported algorithm
+  // ! should be replaced, which would consume the next request. As in the
+  // ! library interface, the refiners are switched to the variant that supports
+  // ! the objective function and all other unsupported combinations are rejected.
+  void prepareContext(Context& context, const Hypergraph& hypergraph) const {
+    if ( context.partition.k < 2 ) {
+      throw InvalidRequest("number of blocks must be at least 2");
+    }
+    if ( ( context.partition.paradigm == Paradigm::nlevel &&
+           context.coarsening.algorithm == CoarseningAlgorithm::multilevel_coarsener ) ||
+         ( context.partition.paradigm == Paradigm::multilevel &&
+           context.coarsening.algorithm == CoarseningAlgorithm::nlevel_coarsener ) ) {
+      throw InvalidRequest("coarsening algorithm does not match the partitioning paradigm");
+    }
+    if ( context.partition.deterministic &&
+         ( context.partition.mode == Mode::deep_multilevel ||
+           context.initial_partitioning.mode == Mode::deep_multilevel ) ) {
+      throw InvalidRequest("deep multilevel partitioning is not supported in deterministic mode");
+    }
+    const std::vector<bool>& enabled_ip_algos = context.initial_partitioning.enabled_ip_algos;
+    if ( !enabled_ip_algos.empty() ) {
+      if ( enabled_ip_algos.size() < static_cast<size_t>(InitialPartitioningAlgorithm::UNDEFINED) ) {
+        throw InvalidRequest("size of enabled IP algorithms vector is smaller than number of IP algorithms");
+      } else if ( std::find(enabled_ip_algos.cbegin(), enabled_ip_algos.cend(), true) == enabled_ip_algos.cend() ) {
+        throw InvalidRequest("at least one initial partitioning algorithm must be enabled");
+      }
+    }
+    if ( context.partition.use_individual_part_weights ) {
+      if ( static_cast<size_t>(context.partition.k) != context.partition.max_part_weights.size() ) {
+        throw InvalidRequest("number of individual part weights is not equal to k");
+      }
+      const HypernodeWeight max_part_weights_sum = std::accumulate(
+        context.partition.max_part_weights.cbegin(), context.partition.max_part_weights.cend(), 0);
+      if ( max_part_weights_sum < hypergraph.totalWeight() ) {
+        throw InvalidRequest("sum of individual part weights is less than the total hypergraph weight");
+      }
+    }
+
+    auto prepareRefinementContext = [&](RefinementParameters& refinement) {
+      if ( context.partition.objective == Objective::cut ) {
+        if ( refinement.label_propagation.algorithm == LabelPropagationAlgorithm::label_propagation_km1 ) {
+          refinement.label_propagation.algorithm = LabelPropagationAlgorithm::label_propagation_cut;
+        }
+        // FM only supports the km1 metric
+        refinement.fm.algorithm = FMAlgorithm::do_nothing;
+      } else if ( refinement.label_propagation.algorithm == LabelPropagationAlgorithm::label_propagation_cut ) {
+        refinement.label_propagation.algorithm = LabelPropagationAlgorithm::label_propagation_km1;
+      }
+    };
+    prepareRefinementContext(context.refinement);
+    prepareRefinementContext(context.initial_partitioning.refinement);
+  }
+
+  const size_t _num_threads;
+  const size_t _utility_id;
+  std::map<std::string, CachedHypergraph> _hypergraphs;
+  MemoryPoolSignature _pool_signature;
+};
+
+} // namespace mt_kahypar
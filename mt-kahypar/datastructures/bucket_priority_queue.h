@@ -0,0 +1,322 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2021 Lars Gottesbüren <lars.gottesbueren@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+
+#include "mt-kahypar/macros.h"
+#include "mt-kahypar/datastructures/priority_queue.h"
+#include "mt-kahypar/parallel/stl/scalable_vector.h"
+
+namespace mt_kahypar {
+namespace ds {
+
+/*!
+ * Addressable max priority queue for integer keys with the same interface as ds::Heap.
+ *
+ * Keys in the range [-max_bucket_key, max_bucket_key] are stored in buckets (one
+ * doubly-linked list per key), which makes insertions, key updates and removals
+ * constant time operations. Keys outside of this range (e.g., the gain of a vertex
+ * without a feasible target block) are stored in an overflow heap. The queue is
+ * intended for small gain ranges (e.g., graphs with unit edge weights), where a
+ * binary heap performs logarithmic work per update.
+ *
+ * As for ds::Heap, the positions of the elements are stored in an external array,
+ * which can be shared by several queues as long as each element is contained in at
+ * most one of them. The elements are stored consecutively such that at(pos) can be
+ * used to iterate over the queue.
+ */
+template<typename KeyT, typename IdT>
+class BucketPriorityQueue {
+
+  static_assert(std::is_integral<KeyT>::value, "Keys must be integers");
+
+  struct Element {
+    KeyT key;
+    IdT id;
+    // predecessor in bucket (or position in overflow heap)
+    PosT prev;
+    // successor in bucket
+    PosT next;
+  };
+
+ public:
+  explicit BucketPriorityQueue(PosT* positions, size_t positions_size, const KeyT max_bucket_key) :
+    _elements(),
+    _buckets(2 * static_cast<size_t>(max_bucket_key) + 1, invalid_position),
+    _overflow(),
+    _min_bucket_key(-static_cast<int64_t>(max_bucket_key)),
+    _num_bucket_elements(0),
+    _top_bucket(0),
+    _positions(positions),
+    _positions_size(positions_size) {
+    ASSERT(max_bucket_key >= 0);
+  }
+
+  IdT top() const {
+    return _elements[topPosition()].id;
+  }
+
+  KeyT topKey() const {
+    return _elements[topPosition()].key;
+  }
+
+  void deleteTop() {
+    ASSERT(!empty());
+    remove(top());
+  }
+
+  void insert(const IdT e, const KeyT k) {
+    ASSERT(!contains(e));
+    ASSERT(size() < _positions_size);
+    const PosT pos = size();
+    _positions[e] = pos;
+    _elements.push_back(Element { k, e, invalid_position, invalid_position });
+    attach(pos);
+  }
+
+  void remove(const IdT e) {
+    ASSERT(!empty() && contains(e));
+    const PosT pos = _positions[e];
+    const PosT last = size() - 1;
+    detach(pos);
+    _positions[e] = invalid_position;
+    if ( pos != last ) {
+      // move last element into the gap
+      detach(last);
+      _elements[pos] = _elements[last];
+      _positions[_elements[pos].id] = pos;
+      _elements.pop_back();
+      attach(pos);
+    } else {
+      _elements.pop_back();
+    }
+  }
+
+  void increaseKey(const IdT e, const KeyT newKey) {
+    ASSERT(contains(e) && getKey(e) < newKey);
+    adjustKey(e, newKey);
+  }
+
+  void decreaseKey(const IdT e, const KeyT newKey) {
+    ASSERT(contains(e) && newKey < getKey(e));
+    adjustKey(e, newKey);
+  }
+
+  void adjustKey(const IdT e, const KeyT newKey) {
+    ASSERT(contains(e));
+    const PosT pos = _positions[e];
+    if ( _elements[pos].key != newKey ) {
+      detach(pos);
+      _elements[pos].key = newKey;
+      attach(pos);
+    }
+  }
+
+  KeyT getKey(const IdT e) const {
+    ASSERT(contains(e));
+    return _elements[_positions[e]].key;
+  }
+
+  void insertOrAdjustKey(const IdT e, const KeyT newKey) {
+    if ( contains(e) ) {
+      adjustKey(e, newKey);
+    } else {
+      insert(e, newKey);
+    }
+  }
+
+  // ! Only resets the buckets that contain elements (and not all buckets)
+  void clear() {
+    for ( const Element& element : _elements ) {
+      if ( inBucketRange(element.key) ) {
+        _buckets[bucket(element.key)] = invalid_position;
+      }
+    }
+    _elements.clear();
+    _overflow.clear();
+    _num_bucket_elements = 0;
+    _top_bucket = 0;
+  }
+
+  bool contains(const IdT e) const {
+    ASSERT(static_cast<size_t>(e) < _positions_size);
+    return _positions[e] < _elements.size() && _elements[_positions[e]].id == e;
+  }
+
+  PosT size() const {
+    return static_cast<PosT>(_elements.size());
+  }
+
+  bool empty() const {
+    return size() == 0;
+  }
+
+  KeyT keyAtPos(const PosT pos) const {
+    return _elements[pos].key;
+  }
+
+  KeyT keyOf(const IdT id) const {
+    return _elements[_positions[id]].key;
+  }
+
+  IdT at(const PosT pos) const {
+    return _elements[pos].id;
+  }
+
+  size_t size_in_bytes() const {
+    return _elements.capacity() * sizeof(Element) +
+      _buckets.capacity() * sizeof(PosT) + _overflow.capacity() * sizeof(PosT);
+  }
+
+ private:
+  bool inBucketRange(const KeyT key) const {
+    const int64_t offset = static_cast<int64_t>(key) - _min_bucket_key;
+    return offset >= 0 && static_cast<size_t>(offset) < _buckets.size();
+  }
+
+  size_t bucket(const KeyT key) const {
+    ASSERT(inBucketRange(key));
+    return static_cast<size_t>(static_cast<int64_t>(key) - _min_bucket_key);
+  }
+
+  // ! Position of the element with the largest key. Skips empty buckets
+  // ! left behind by removals.
+  PosT topPosition() const {
+    ASSERT(!empty());
+    PosT pos = invalid_position;
+    if ( _num_bucket_elements > 0 ) {
+      while ( _buckets[_top_bucket] == invalid_position ) {
+        ASSERT(_top_bucket > 0);
+        --_top_bucket;
+      }
+      pos = _buckets[_top_bucket];
+    }
+    if ( !_overflow.empty() &&
+         ( pos == invalid_position || _elements[pos].key < _elements[_overflow[0]].key ) ) {
+      pos = _overflow[0];
+    }
+    return pos;
+  }
+
+  void attach(const PosT pos) {
+    Element& element = _elements[pos];
+    if ( inBucketRange(element.key) ) {
+      const size_t b = bucket(element.key);
+      element.prev = invalid_position;
+      element.next = _buckets[b];
+      if ( element.next != invalid_position ) {
+        _elements[element.next].prev = pos;
+      }
+      _buckets[b] = pos;
+      if ( _num_bucket_elements == 0 || b > _top_bucket ) {
+        _top_bucket = b;
+      }
+      ++_num_bucket_elements;
+    } else {
+      element.prev = _overflow.size();
+      _overflow.push_back(pos);
+      siftUp(element.prev);
+    }
+  }
+
+  void detach(const PosT pos) {
+    const Element& element = _elements[pos];
+    if ( inBucketRange(element.key) ) {
+      if ( element.prev != invalid_position ) {
+        _elements[element.prev].next = element.next;
+      } else {
+        _buckets[bucket(element.key)] = element.next;
+      }
+      if ( element.next != invalid_position ) {
+        _elements[element.next].prev = element.prev;
+      }
+      --_num_bucket_elements;
+    } else {
+      const PosT heap_pos = element.prev;
+      const PosT last = _overflow.back();
+      _overflow.pop_back();
+      if ( heap_pos < _overflow.size() ) {
+        _overflow[heap_pos] = last;
+        _elements[last].prev = heap_pos;
+        siftUp(heap_pos);
+        siftDown(_elements[last].prev);
+      }
+    }
+  }
+
+  void swapOverflow(const PosT i, const PosT j) {
+    std::swap(_overflow[i], _overflow[j]);
+    _elements[_overflow[i]].prev = i;
+    _elements[_overflow[j]].prev = j;
+  }
+
+  KeyT overflowKey(const PosT i) const {
+    return _elements[_overflow[i]].key;
+  }
+
+  void siftUp(PosT i) {
+    while ( i > 0 && overflowKey((i - 1) / 2) < overflowKey(i) ) {
+      swapOverflow(i, (i - 1) / 2);
+      i = (i - 1) / 2;
+    }
+  }
+
+  void siftDown(PosT i) {
+    while ( 2 * i + 1 < _overflow.size() ) {
+      PosT child = 2 * i + 1;
+      if ( child + 1 < _overflow.size() && overflowKey(child) < overflowKey(child + 1) ) {
+        ++child;
+      }
+      if ( !(overflowKey(i) < overflowKey(child)) ) {
+        break;
+      }
+      swapOverflow(i, child);
+      i = child;
+    }
+  }
+
+  // ! Contained elements
+  vec<Element> _elements;
+  // ! First element of each bucket
+  vec<PosT> _buckets;
+  // ! Binary max heap of the elements with keys outside of the bucket range
+  vec<PosT> _overflow;
+  // ! Key of the first bucket
+  int64_t _min_bucket_key;
+  // ! Number of elements stored in buckets
+  size_t _num_bucket_elements;
+  // ! Upper bound for the largest non-empty bucket
+  mutable size_t _top_bucket;
+  // ! Positions of the elements in _elements (shared with other queues)
+  PosT* _positions;
+  size_t _positions_size;
+};
+
+} // namespace ds
+} // namespace mt_kahypar
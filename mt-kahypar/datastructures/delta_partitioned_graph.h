@@ -66,6 +66,7 @@ class DeltaPartitionedGraph {
     _k(kInvalidPartition),
     _pg(nullptr),
     _part_weights_delta(0, 0),
+    _incident_weight_in_part_delta_initial_size(MAP_SIZE_LARGE),
     _part_ids_delta(),
     _incident_weight_in_part_delta() {}
 
@@ -73,11 +74,11 @@ class DeltaPartitionedGraph {
     _k(context.partition.k),
     _pg(nullptr),
     _part_weights_delta(context.partition.k, 0),
+    _incident_weight_in_part_delta_initial_size(
+      context.type == ContextType::main ? MAP_SIZE_LARGE : MAP_SIZE_MOVE_DELTA),
     _part_ids_delta(),
     _incident_weight_in_part_delta() {
-      const bool top_level = context.type == ContextType::main;
-      _part_ids_delta.initialize(MAP_SIZE_SMALL);
-      _incident_weight_in_part_delta.initialize(top_level ? MAP_SIZE_LARGE : MAP_SIZE_MOVE_DELTA);
+      resetMemory();
     }
 
   DeltaPartitionedGraph(const DeltaPartitionedGraph&) = delete;
@@ -297,12 +298,12 @@ class DeltaPartitionedGraph {
     _incident_weight_in_part_delta.clear();
   }
 
-  void dropMemory() {
-    if (!_memory_dropped) {
-      _memory_dropped = true;
-      _part_ids_delta.freeInternalData();
-      _incident_weight_in_part_delta.freeInternalData();
-    }
+  // ! Releases the memory of the hash tables and re-initializes them with
+  // ! their initial capacity (also clears all deltas)
+  void resetMemory() {
+    _part_weights_delta.assign(_k, 0);
+    _part_ids_delta.initialize(MAP_SIZE_SMALL);
+    _incident_weight_in_part_delta.initialize(_incident_weight_in_part_delta_initial_size);
   }
 
   size_t combinedMemoryConsumption() const {
@@ -332,8 +333,6 @@ class DeltaPartitionedGraph {
     return size_t(u) * _k  + p;
   }
 
-  bool _memory_dropped = false;
-
   // ! Number of blocks
   PartitionID _k;
 
@@ -343,6 +342,9 @@ class DeltaPartitionedGraph {
   // ! Delta for block weights
   vec< HypernodeWeight > _part_weights_delta;
 
+  // ! Initial capacity of the incident weight in part delta
+  size_t _incident_weight_in_part_delta_initial_size;
+
   // ! Stores for each locally moved node its new block id
   DynamicFlatMap<HypernodeID, PartitionID> _part_ids_delta;
 
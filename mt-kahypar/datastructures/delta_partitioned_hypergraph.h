@@ -76,6 +76,7 @@ class DeltaPartitionedHypergraph {
     _k(kInvalidPartition),
     _phg(nullptr),
     _part_weights_delta(0, 0),
+    _gain_cache_delta_initial_size(MAP_SIZE_LARGE),
     _part_ids_delta(),
     _pins_in_part_delta(),
     _gain_cache_delta() {}
@@ -84,13 +85,11 @@ class DeltaPartitionedHypergraph {
     _k(context.partition.k),
     _phg(nullptr),
     _part_weights_delta(context.partition.k, 0),
+    _gain_cache_delta_initial_size(context.type == ContextType::main ? MAP_SIZE_LARGE : MAP_SIZE_MOVE_DELTA),
     _part_ids_delta(),
     _pins_in_part_delta(),
     _gain_cache_delta() {
-      const bool top_level = context.type == ContextType::main;
-      _part_ids_delta.initialize(MAP_SIZE_SMALL);
-      _pins_in_part_delta.initialize(MAP_SIZE_LARGE);
-      _gain_cache_delta.initialize(top_level ? MAP_SIZE_LARGE : MAP_SIZE_MOVE_DELTA);
+      resetMemory();
     }
 
   DeltaPartitionedHypergraph(const DeltaPartitionedHypergraph&) = delete;
@@ -209,6 +208,10 @@ class DeltaPartitionedHypergraph {
   void gainCacheUpdate(const HyperedgeID he, const HyperedgeWeight we,
                        const PartitionID from, const HypernodeID pin_count_in_from_part_after,
                        const PartitionID to, const HypernodeID pin_count_in_to_part_after) {
+    if ( _phg->isLargeHyperedge(he) ) {
+      // large hyperedges are not represented in the gain cache
+      return;
+    }
 
     if (pin_count_in_from_part_after == 1) {
       for (HypernodeID u : pins(he)) {
@@ -301,13 +304,13 @@ class DeltaPartitionedHypergraph {
     _gain_cache_delta.clear();
   }
 
-  void dropMemory() {
-    if (!_memory_dropped) {
-      _memory_dropped = true;
-      _part_ids_delta.freeInternalData();
-      _pins_in_part_delta.freeInternalData();
-      _gain_cache_delta.freeInternalData();
-    }
+  // ! Releases the memory of the hash tables and re-initializes them with
+  // ! their initial capacity (also clears all deltas)
+  void resetMemory() {
+    _part_weights_delta.assign(_k, 0);
+    _part_ids_delta.initialize(MAP_SIZE_SMALL);
+    _pins_in_part_delta.initialize(MAP_SIZE_LARGE);
+    _gain_cache_delta.initialize(_gain_cache_delta_initial_size);
   }
 
   size_t combinedMemoryConsumption() const {
@@ -358,8 +361,6 @@ class DeltaPartitionedHypergraph {
       _phg->pinCountInPart(e, p)) + ++_pins_in_part_delta[e * _k + p], static_cast<int32_t>(0));
   }
 
-  bool _memory_dropped = false;
-
   // ! Number of blocks
   PartitionID _k;
 
@@ -369,6 +370,9 @@ class DeltaPartitionedHypergraph {
   // ! Delta for block weights
   vec< HypernodeWeight > _part_weights_delta;
 
+  // ! Initial capacity of the gain cache delta
+  size_t _gain_cache_delta_initial_size;
+
   // ! Stores for each locally moved node, its new block id
   DynamicFlatMap<HypernodeID, PartitionID> _part_ids_delta;
 
@@ -621,7 +621,7 @@ class DynamicGraph {
 
   // ####################### Contract / Uncontract #######################
 
-  DynamicGraph contract(parallel::scalable_vector<HypernodeID>&) {
+  DynamicGraph contract(parallel::scalable_vector<HypernodeID>&, const bool = false) {
     ERROR("contract(c, id) is not supported in dynamic graph");
     return DynamicGraph();
   }
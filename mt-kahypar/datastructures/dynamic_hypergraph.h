@@ -722,7 +722,7 @@ class DynamicHypergraph {
 
   // ####################### Contract / Uncontract #######################
 
-  DynamicHypergraph contract(parallel::scalable_vector<HypernodeID>&) {
+  DynamicHypergraph contract(parallel::scalable_vector<HypernodeID>&, const bool = false) {
     ERROR("contract(c, id) is not supported in dynamic hypergraph");
     return DynamicHypergraph();
   }
@@ -27,6 +27,7 @@
 
 #include "graph.h"
 
+#include "mt-kahypar/datastructures/star_expansion_graph.h"
 
 #include <tbb/parallel_for.h>
 #include <tbb/parallel_reduce.h>
@@ -124,25 +125,31 @@ namespace mt_kahypar::ds {
   }
 
   Graph Graph::contract_low_memory(Clustering& communities) {
+    return contract_low_memory(*this, communities);
+  }
+
+  template<typename GraphT>
+  Graph Graph::contract_low_memory(const GraphT& fine_graph, Clustering& communities) {
+    const size_t num_fine_nodes = fine_graph.numNodes();
     // map cluster IDs to consecutive range
-    vec<NodeID> mapping(numNodes(), 0);   // TODO use memory pool?
-    tbb::parallel_for(0UL, numNodes(), [&](NodeID u) { mapping[communities[u]] = 1; });
-    parallel_prefix_sum(mapping.begin(), mapping.begin() + numNodes(), mapping.begin(), std::plus<>(), 0);
-    NodeID num_coarse_nodes = mapping[numNodes() - 1];
+    vec<NodeID> mapping(num_fine_nodes, 0);   // TODO use memory pool?
+    tbb::parallel_for(0UL, num_fine_nodes, [&](NodeID u) { mapping[communities[u]] = 1; });
+    parallel_prefix_sum(mapping.begin(), mapping.begin() + num_fine_nodes, mapping.begin(), std::plus<>(), 0);
+    NodeID num_coarse_nodes = mapping[num_fine_nodes - 1];
     // apply mapping to cluster IDs. subtract one because prefix sum is inclusive
-    tbb::parallel_for(0UL, numNodes(), [&](NodeID u) { communities[u] = mapping[communities[u]] - 1; });
+    tbb::parallel_for(0UL, num_fine_nodes, [&](NodeID u) { communities[u] = mapping[communities[u]] - 1; });
 
     // sort nodes by cluster
     auto get_cluster = [&](NodeID u) { assert(u < communities.size()); return communities[u]; };
     vec<NodeID> nodes_sorted_by_cluster(std::move(mapping));    // reuse memory from mapping since it's no longer needed
-    auto cluster_bounds = parallel::counting_sort(nodes(), nodes_sorted_by_cluster, num_coarse_nodes,
+    auto cluster_bounds = parallel::counting_sort(fine_graph.nodes(), nodes_sorted_by_cluster, num_coarse_nodes,
                                                   get_cluster, TBBInitializer::instance().total_number_of_threads());
 
     Graph coarse_graph;
     coarse_graph._num_nodes = num_coarse_nodes;
     coarse_graph._indices.resize(num_coarse_nodes + 1);
     coarse_graph._node_volumes.resize(num_coarse_nodes);
-    coarse_graph._total_volume = totalVolume();
+    coarse_graph._total_volume = fine_graph.totalVolume();
 
     struct ClearList {
       vec<NodeID> used;
@@ -159,8 +166,8 @@ namespace mt_kahypar::ds {
       ArcWeight volume_cu = 0.0;
       for (auto i = cluster_bounds[cu]; i < cluster_bounds[cu + 1]; ++i) {
         NodeID fu = nodes_sorted_by_cluster[i];
-        volume_cu += nodeVolume(fu);
-        for (const Arc& arc : arcsOf(fu)) {
+        volume_cu += fine_graph.nodeVolume(fu);
+        for (const Arc& arc : fine_graph.arcsOf(fu)) {
           NodeID cv = get_cluster(arc.head);
           if (cv != cu && clear_list.values[cv] == 0.0) {
             clear_list.used.push_back(cv);
@@ -188,7 +195,7 @@ namespace mt_kahypar::ds {
     tbb::parallel_for(0U, num_coarse_nodes, [&](NodeID cu) {
       auto& clear_list = clear_lists.local();
       for (auto i = cluster_bounds[cu]; i < cluster_bounds[cu+1]; ++i) {
-        for (const Arc& arc : arcsOf(nodes_sorted_by_cluster[i])) {
+        for (const Arc& arc : fine_graph.arcsOf(nodes_sorted_by_cluster[i])) {
           NodeID cv = get_cluster(arc.head);
           if (cv != cu) {
             if (clear_list.values[cv] == 0.0) {
@@ -209,6 +216,9 @@ namespace mt_kahypar::ds {
     return coarse_graph;
   }
 
+  template Graph Graph::contract_low_memory(const Graph& fine_graph, Clustering& communities);
+  template Graph Graph::contract_low_memory(const StarExpansionGraph& fine_graph, Clustering& communities);
+
 
   /*!
  * Contracts the graph based on the community structure passed as argument.
@@ -144,6 +144,11 @@ class Graph {
 
   Graph contract_low_memory(Clustering& communities);
 
+  // ! Contracts an arbitrary graph with the Graph interface (e.g., the implicit
+  // ! StarExpansionGraph) into a Graph. The fine graph is not modified.
+  template<typename GraphT>
+  static Graph contract_low_memory(const GraphT& fine_graph, Clustering& communities);
+
   void allocateContractionBuffers() {
     _tmp_graph_buffer = new TmpGraphBuffer(_num_nodes, _num_arcs);
   }
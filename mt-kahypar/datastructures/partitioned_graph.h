@@ -177,6 +177,15 @@ private:
     _part_ids.assign(hypergraph.initialNumNodes(), CAtomic<PartitionID>(kInvalidPartition), false);
   }
 
+  // ! Constructs a partitioned graph that is modified by exactly one thread (e.g., the
+  // ! thread-local partitions of the coarsest graph during flat initial partitioning).
+  // ! Note, the edge locks are still required to synchronize the delta functions passed
+  // ! to changeNodePart(...), which is why this is equivalent to the sequential constructor.
+  explicit PartitionedGraph(const PartitionID k,
+                            Hypergraph& hypergraph,
+                            thread_exclusive_tag_t) :
+    PartitionedGraph(k, hypergraph) { }
+
   explicit PartitionedGraph(const PartitionID k,
                             Hypergraph& hypergraph,
                             parallel_tag_t) :
@@ -454,6 +463,14 @@ private:
     return _part_ids[u].load(std::memory_order_relaxed);
   }
 
+  // ! Prefetches the blocks of all neighbors of u, which are
+  // ! required to compute the gain of moving u
+  void prefetchIncidentPartitionInfo(const HypernodeID u) const {
+    for ( const HyperedgeID& e : incidentEdges(u) ) {
+      __builtin_prefetch(&_part_ids[edgeTarget(e)]);
+    }
+  }
+
   void extractPartIDs(Array<CAtomic<PartitionID>>& part_ids) {
     std::swap(_part_ids, part_ids);
   }
@@ -632,7 +649,8 @@ private:
   }
 
   // ! Initialize gain cache
-  void initializeGainCache() {
+  // ! (all edges of a graph have two pins, i.e., the large hyperedge threshold has no effect)
+  void initializeGainCache(const HypernodeID = std::numeric_limits<HypernodeID>::max()) {
     allocateGainTableIfNecessary();
 
     // assert that part has been initialized
@@ -82,6 +82,7 @@ private:
   explicit PartitionedHypergraph(const PartitionID k,
                                  Hypergraph& hypergraph) :
     _is_gain_cache_initialized(false),
+    _is_thread_exclusive(false),
     _top_level_num_nodes(hypergraph.initialNumNodes()),
     _k(k),
     _hg(&hypergraph),
@@ -90,16 +91,35 @@ private:
         "Refinement", "part_ids", hypergraph.initialNumNodes(), false, false),
     _pins_in_part(hypergraph.initialNumEdges(), k, hypergraph.maxEdgeSize(), false),
     _connectivity_set(hypergraph.initialNumEdges(), k, false),
-    _gain_cache(),
-    _pin_count_update_ownership(
-        "Refinement", "pin_count_update_ownership", hypergraph.initialNumEdges(), true, false) {
+    _gain_cache() {
     _part_ids.assign(hypergraph.initialNumNodes(), kInvalidPartition, false);
   }
 
+  // ! Constructs a partitioned hypergraph that is modified by exactly one thread
+  // ! (e.g., the thread-local partitions of the coarsest hypergraph during flat initial
+  // ! partitioning). All threads share the underlying hypergraph and only store their
+  // ! own partition state. Pin count updates do not have to be atomic.
+  explicit PartitionedHypergraph(const PartitionID k,
+                                 Hypergraph& hypergraph,
+                                 thread_exclusive_tag_t) :
+    _is_gain_cache_initialized(false),
+    _is_thread_exclusive(true),
+    _top_level_num_nodes(hypergraph.initialNumNodes()),
+    _k(k),
+    _hg(&hypergraph),
+    _part_weights(k, CAtomic<HypernodeWeight>(0)),
+    _part_ids(),
+    _pins_in_part(hypergraph.initialNumEdges(), k, hypergraph.maxEdgeSize(), false),
+    _connectivity_set(hypergraph.initialNumEdges(), k, false),
+    _gain_cache() {
+    _part_ids.resize(hypergraph.initialNumNodes(), kInvalidPartition, false);
+  }
+
   explicit PartitionedHypergraph(const PartitionID k,
                                  Hypergraph& hypergraph,
                                  parallel_tag_t) :
     _is_gain_cache_initialized(false),
+    _is_thread_exclusive(false),
     _top_level_num_nodes(hypergraph.initialNumNodes()),
     _k(k),
     _hg(&hypergraph),
@@ -107,8 +127,7 @@ private:
     _part_ids(),
     _pins_in_part(),
     _connectivity_set(0, 0),
-    _gain_cache(),
-    _pin_count_update_ownership() {
+    _gain_cache() {
     tbb::parallel_invoke([&] {
       _part_ids.resize(
         "Refinement", "vertex_part_info", hypergraph.initialNumNodes());
@@ -117,9 +136,6 @@ private:
       _pins_in_part.initialize(hypergraph.initialNumEdges(), k, hypergraph.maxEdgeSize());
     }, [&] {
       _connectivity_set = ConnectivitySets(hypergraph.initialNumEdges(), k);
-    }, [&] {
-      _pin_count_update_ownership.resize(
-        "Refinement", "pin_count_update_ownership", hypergraph.initialNumEdges(), true);
     });
   }
 
@@ -637,6 +653,14 @@ private:
     return _pins_in_part.pinCountInPart(e, p);
   }
 
+  // ! Prefetches the pin counts of all incident hyperedges of u, which are
+  // ! required to compute the gain of moving u
+  void prefetchIncidentPartitionInfo(const HypernodeID u) const {
+    for ( const HyperedgeID& he : incidentEdges(u) ) {
+      _pins_in_part.prefetch(he);
+    }
+  }
+
   /**
    * In the following, we define functions to derive the benefit and penalty term
    * decribed in our publications. However, we swapped the naming of both (the benefit term
@@ -687,7 +711,7 @@ private:
     const PartitionID p = partID(u);
     HyperedgeWeight b = 0;
     for (HyperedgeID e : incidentEdges(u)) {
-      if (pinCountInPart(e, p) > 1) {
+      if (pinCountInPart(e, p) > 1 && !isLargeHyperedge(e)) {
         b += edgeWeight(e);
       }
     }
@@ -705,7 +729,7 @@ private:
   HyperedgeWeight moveToBenefitRecomputed(const HypernodeID u, PartitionID p) const {
     HyperedgeWeight w = 0;
     for (HyperedgeID e : incidentEdges(u)) {
-      if (pinCountInPart(e, p) >= 1) {
+      if (pinCountInPart(e, p) >= 1 && !isLargeHyperedge(e)) {
         w += edgeWeight(e);
       }
     }
@@ -730,6 +754,9 @@ private:
     PartitionID pu = partID(u);
     Gain penalty = 0;
     for (const HyperedgeID& e : incidentEdges(u)) {
+      if ( isLargeHyperedge(e) ) {
+        continue;
+      }
       HyperedgeWeight ew = edgeWeight(e);
       if (pinCountInPart(e, pu) > 1) {
         penalty += ew;
@@ -746,11 +773,20 @@ private:
     }
   }
 
+  // ! Hyperedges with more pins than large_hyperedge_threshold are not represented
+  // ! in the gain cache. The gain cache entries then only approximate the gain, since
+  // ! they ignore large hyperedges, but moves never iterate over their pins to update
+  // ! the gain cache. Pin counts and connectivity sets of large hyperedges are exact.
+  bool isLargeHyperedge(const HyperedgeID e) const {
+    return edgeSize(e) > _large_hyperedge_threshold;
+  }
+
   // ! Initialize gain cache
   // ! NOTE: Requires that pin counts are already initialized and reflect the
   // ! current state of the partition
-  void initializeGainCache() {
+  void initializeGainCache(const HypernodeID large_hyperedge_threshold = std::numeric_limits<HypernodeID>::max()) {
     allocateGainTableIfNecessary();
+    _large_hyperedge_threshold = large_hyperedge_threshold;
 
     // check whether part has been initialized
     ASSERT(std::none_of(nodes().begin(), nodes().end(),
@@ -761,6 +797,9 @@ private:
           const HyperedgeID he,
           HyperedgeWeight& l_move_from_penalty,
           vec<HyperedgeWeight>& l_move_to_benefit) {
+      if ( isLargeHyperedge(he) ) {
+        return;
+      }
       HyperedgeWeight edge_weight = edgeWeight(he);
       if (pinCountInPart(he, block_of_u) > 1) {
         l_move_from_penalty += edge_weight;
@@ -939,7 +978,6 @@ private:
     parent->addChild("Part IDs", sizeof(PartitionID) * _hg->initialNumNodes());
     parent->addChild("Pin Count In Part", _pins_in_part.size_in_bytes());
     parent->addChild("Gain Cache", sizeof(HyperedgeWeight) * _gain_cache.size());
-    parent->addChild("HE Ownership", sizeof(SpinLock) * _hg->initialNumNodes());
   }
 
   // ####################### Extract Block #######################
@@ -1020,7 +1058,7 @@ private:
   void freeInternalData() {
     if ( _k > 0 ) {
       tbb::parallel_invoke( [&] {
-        parallel::parallel_free(_part_ids, _pin_count_update_ownership);
+        parallel::free(_part_ids);
       }, [&] {
         parallel::free(_pins_in_part.data());
       }, [&] {
@@ -1035,6 +1073,11 @@ private:
   void gainCacheUpdate(const HyperedgeID he, const HyperedgeWeight we,
                        const PartitionID from, const HypernodeID pin_count_in_from_part_after,
                        const PartitionID to, const HypernodeID pin_count_in_to_part_after) {
+    if ( isLargeHyperedge(he) ) {
+      // large hyperedges are not represented in the gain cache
+      return;
+    }
+
     if (pin_count_in_from_part_after == 1) {
       for (const HypernodeID& u : pins(he)) {
         nodeGainAssertions(u, from);
@@ -1146,16 +1189,31 @@ private:
     ASSERT(benefit_index(u, p) < _gain_cache.size());
   }
 
-  // ! Updates pin count in part using a spinlock.
+  // ! Updates pin count in part with atomic operations (not required, if the partition
+  // ! is exclusively modified by one thread). Each transition of a pin count entry is
+  // ! observed by exactly one thread, which is sufficient for the gain updates performed
+  // ! in delta_func (they only depend on the pin count after the move in each block).
   MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE void updatePinCountOfHyperedge(const HyperedgeID he,
                                                                     const PartitionID from,
                                                                     const PartitionID to,
                                                                     const DeltaFunction& delta_func) {
-    ASSERT(he < _pin_count_update_ownership.size());
-    _pin_count_update_ownership[he].lock();
-    const HypernodeID pin_count_in_from_part_after = decrementPinCountInPartWithoutGainUpdate(he, from);
-    const HypernodeID pin_count_in_to_part_after = incrementPinCountInPartWithoutGainUpdate(he, to);
-    _pin_count_update_ownership[he].unlock();
+    HypernodeID pin_count_in_from_part_after = 0;
+    HypernodeID pin_count_in_to_part_after = 0;
+    if ( _is_thread_exclusive ) {
+      pin_count_in_from_part_after = decrementPinCountInPartWithoutGainUpdate(he, from);
+      pin_count_in_to_part_after = incrementPinCountInPartWithoutGainUpdate(he, to);
+    } else {
+      ASSERT(he < _hg->initialNumEdges(), "Hyperedge" << he << "does not exist");
+      ASSERT(edgeIsEnabled(he), "Hyperedge" << he << "is disabled");
+      _pins_in_part.movePinAtomically(he, from, to,
+        pin_count_in_from_part_after, pin_count_in_to_part_after);
+      if ( pin_count_in_from_part_after == 0 ) {
+        _connectivity_set.remove(he, from);
+      }
+      if ( pin_count_in_to_part_after == 1 ) {
+        _connectivity_set.add(he, to);
+      }
+    }
     delta_func(he, edgeWeight(he), edgeSize(he), pin_count_in_from_part_after, pin_count_in_to_part_after);
   }
 
@@ -1187,6 +1245,12 @@ private:
   // ! Indicate wheater gain cache is initialized
   bool _is_gain_cache_initialized;
 
+  // ! Hyperedges with more pins are not represented in the gain cache
+  HypernodeID _large_hyperedge_threshold = std::numeric_limits<HypernodeID>::max();
+
+  // ! Indicates whether the partition is exclusively modified by one thread
+  bool _is_thread_exclusive = false;
+
   size_t _top_level_num_nodes = 0;
 
   // ! Number of blocks
@@ -1215,10 +1279,6 @@ private:
   // ! We call b(u, V_j) the benefit term and p(u) the penalty term. Our gain cache stores and maintains these
   // ! entries for each node and block. Thus, the gain cache stores k + 1 entries per node.
   Array< CAtomic<HyperedgeWeight> > _gain_cache;
-
-  // ! In order to update the pin count of a hyperedge thread-safe, a thread must acquire
-  // ! the ownership of a hyperedge via a CAS operation.
-  Array<SpinLock> _pin_count_update_ownership;
 };
 
 } // namespace ds
@@ -47,9 +47,10 @@ namespace ds {
  * each entry occupies exactly the number of bits it requires to store the
  * maximum value. To do so, we store several pin count entries in a 64-bit unsigned
  * integer.
- * Note, this data structure is not thread-safe. Updates of a pin count entry
- * of a hyperedge must be done exclusively. Different hyperedges can be updated
- * concurrently.
+ * Note, incrementPinCountInPart(...), decrementPinCountInPart(...) and
+ * setPinCountInPart(...) are not thread-safe. Updates of a pin count entry
+ * of a hyperedge must be done exclusively. Concurrent updates of the same hyperedge
+ * are only possible via movePinAtomically(...).
  */
 class PinCountInPart {
 
@@ -136,8 +137,8 @@ class PinCountInPart {
                                     const PartitionID id) const {
     ASSERT(he < _num_hyperedges);
     ASSERT(id != kInvalidPartition && id < _k);
-    const size_t value_pos = he * _values_per_hyperedge + id / _entries_per_value;
-    const size_t bit_pos = (id % _entries_per_value) * _bits_per_element;
+    const size_t value_pos = valuePosition(he, id);
+    const size_t bit_pos = bitPosition(id);
     const Value mask = _extraction_mask << bit_pos;
     return (_pin_count_in_part[value_pos] & mask) >> bit_pos;
   }
@@ -148,8 +149,8 @@ class PinCountInPart {
                                 const HypernodeID value) {
     ASSERT(he < _num_hyperedges);
     ASSERT(id != kInvalidPartition && id < _k);
-    const size_t value_pos = he * _values_per_hyperedge + id / _entries_per_value;
-    const size_t bit_pos = (id % _entries_per_value) * _bits_per_element;
+    const size_t value_pos = valuePosition(he, id);
+    const size_t bit_pos = bitPosition(id);
     updateEntry(_pin_count_in_part[value_pos], bit_pos, value);
   }
 
@@ -158,8 +159,8 @@ class PinCountInPart {
                                              const PartitionID id) {
     ASSERT(he < _num_hyperedges);
     ASSERT(id != kInvalidPartition && id < _k);
-    const size_t value_pos = he * _values_per_hyperedge + id / _entries_per_value;
-    const size_t bit_pos = (id % _entries_per_value) * _bits_per_element;
+    const size_t value_pos = valuePosition(he, id);
+    const size_t bit_pos = bitPosition(id);
     const Value mask = _extraction_mask << bit_pos;
     Value& current_value = _pin_count_in_part[value_pos];
     Value pin_count_in_part = (current_value & mask) >> bit_pos;
@@ -173,8 +174,8 @@ class PinCountInPart {
                                              const PartitionID id) {
     ASSERT(he < _num_hyperedges);
     ASSERT(id != kInvalidPartition && id < _k);
-    const size_t value_pos = he * _values_per_hyperedge + id / _entries_per_value;
-    const size_t bit_pos = (id % _entries_per_value) * _bits_per_element;
+    const size_t value_pos = valuePosition(he, id);
+    const size_t bit_pos = bitPosition(id);
     const Value mask = _extraction_mask << bit_pos;
     Value& current_value = _pin_count_in_part[value_pos];
     Value pin_count_in_part = (current_value & mask) >> bit_pos;
@@ -183,6 +184,50 @@ class PinCountInPart {
     return pin_count_in_part - 1;
   }
 
+  // ! Moves a pin of the hyperedge from block 'from' to block 'to' and stores the pin
+  // ! counts after the move. Can be called concurrently for the same hyperedge.
+  // ! If both entries are stored in the same value (which is always the case if all
+  // ! pin counts of a hyperedge fit into one value), the move is performed with one
+  // ! fetch-and-add and the returned pin counts correspond to the same state of the
+  // ! hyperedge. Otherwise, each entry is updated with its own fetch-and-add.
+  // ! Note, the entry of block 'from' is at least one and the entry of block 'to'
+  // ! is smaller than the maximum value. Thus, the additions can not overflow
+  // ! into neighboring entries.
+  inline void movePinAtomically(const HyperedgeID he,
+                                const PartitionID from,
+                                const PartitionID to,
+                                HypernodeID& pin_count_in_from_part_after,
+                                HypernodeID& pin_count_in_to_part_after) {
+    ASSERT(he < _num_hyperedges);
+    ASSERT(from != kInvalidPartition && from < _k);
+    ASSERT(to != kInvalidPartition && to < _k);
+    const size_t from_value_pos = valuePosition(he, from);
+    const size_t to_value_pos = valuePosition(he, to);
+    const size_t from_bit_pos = bitPosition(from);
+    const size_t to_bit_pos = bitPosition(to);
+    if ( from_value_pos == to_value_pos ) {
+      const Value delta = (Value(1) << to_bit_pos) - (Value(1) << from_bit_pos);
+      const Value before = __atomic_fetch_add(
+        &_pin_count_in_part[from_value_pos], delta, __ATOMIC_RELAXED);
+      pin_count_in_from_part_after = extractEntry(before, from_bit_pos) - 1;
+      pin_count_in_to_part_after = extractEntry(before, to_bit_pos) + 1;
+    } else {
+      const Value from_before = __atomic_fetch_sub(
+        &_pin_count_in_part[from_value_pos], Value(1) << from_bit_pos, __ATOMIC_RELAXED);
+      const Value to_before = __atomic_fetch_add(
+        &_pin_count_in_part[to_value_pos], Value(1) << to_bit_pos, __ATOMIC_RELAXED);
+      pin_count_in_from_part_after = extractEntry(from_before, from_bit_pos) - 1;
+      pin_count_in_to_part_after = extractEntry(to_before, to_bit_pos) + 1;
+    }
+    ASSERT(pin_count_in_to_part_after <= _max_value);
+  }
+
+  // ! Prefetches the (first) value storing the pin counts of the hyperedge
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE void prefetch(const HyperedgeID he) const {
+    ASSERT(he < _num_hyperedges);
+    __builtin_prefetch(_pin_count_in_part.data() + static_cast<size_t>(he) * _values_per_hyperedge);
+  }
+
   // ! Returns the size in bytes of this data structure
   size_t size_in_bytes() const {
     return sizeof(Value) * _pin_count_in_part.size();
@@ -195,6 +240,22 @@ class PinCountInPart {
   }
 
  private:
+  // ! If all pin counts of a hyperedge fit into one value (which is always the case
+  // ! for bisections), we can avoid the integer divisions of the general case.
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE size_t valuePosition(const HyperedgeID he,
+                                                          const PartitionID id) const {
+    return _values_per_hyperedge == 1 ? he : he * _values_per_hyperedge + id / _entries_per_value;
+  }
+
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE size_t bitPosition(const PartitionID id) const {
+    return ( _values_per_hyperedge == 1 ? id : id % _entries_per_value ) * _bits_per_element;
+  }
+
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE HypernodeID extractEntry(const Value value,
+                                                              const size_t bit_pos) const {
+    return (value >> bit_pos) & _extraction_mask;
+  }
+
   inline void updateEntry(Value& value,
                           const size_t bit_pos,
                           const Value new_value) {
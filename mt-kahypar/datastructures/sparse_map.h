@@ -38,6 +38,7 @@
 #include <utility>
 #include <vector>
 #include <cmath>
+#include <cstring>
 
 #include "kahypar/macros.h"
 #include "kahypar/meta/mandatory.h"
@@ -512,6 +513,14 @@ class DynamicMapBase {
   void clear() {
     _size = 0;
     ++_timestamp;
+    using Timestamp = typename Derived::Timestamp;
+    if constexpr ( sizeof(Timestamp) < sizeof(size_t) ) {
+      if ( _timestamp > std::numeric_limits<Timestamp>::max() ) {
+        // Timestamp overflow => reset all slots
+        memset(_data.get(), 0, static_cast<const Derived*>(this)->size_in_bytes());
+        _timestamp = 1;
+      }
+    }
   }
 
  private:
@@ -558,9 +567,11 @@ class DynamicSparseMap final : public DynamicMapBase<Key, Value, DynamicSparseMa
     Value value;
   };
 
+  using Timestamp = size_t;
+
   struct SparseElement {
     MapElement* element;
-    size_t timestamp;
+    Timestamp timestamp;
   };
 
   using Base = DynamicMapBase<Key, Value, DynamicSparseMap<Key, Value>>;
@@ -670,10 +681,14 @@ template <typename Key = Mandatory,
           typename Value = Mandatory>
 class DynamicFlatMap final : public DynamicMapBase<Key, Value, DynamicFlatMap<Key, Value>> {
 
+  // A 32-bit timestamp keeps the elements compact, e.g., 16 instead of 24 bytes for
+  // 64-bit keys with 32-bit values (the map is reset if the timestamp overflows)
+  using Timestamp = uint32_t;
+
   struct MapElement {
     Key key;
     Value value;
-    size_t timestamp;
+    Timestamp timestamp;
   };
 
   using Base = DynamicMapBase<Key, Value, DynamicFlatMap<Key, Value>>;
@@ -726,7 +741,7 @@ class DynamicFlatMap final : public DynamicMapBase<Key, Value, DynamicFlatMap<Ke
 
   MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE Value& addElementImpl(Key key, Value value, const size_t pos) {
     ASSERT(pos < _capacity);
-    _elements[pos] = MapElement { key, value, _timestamp };
+    _elements[pos] = MapElement { key, value, static_cast<Timestamp>(_timestamp) };
     _size++;
     return _elements[pos].value;
   }
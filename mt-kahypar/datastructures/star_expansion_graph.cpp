@@ -0,0 +1,90 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2021 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include "star_expansion_graph.h"
+
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_reduce.h>
+#include <tbb/enumerable_thread_specific.h>
+
+namespace mt_kahypar::ds {
+
+  StarExpansionGraph::StarExpansionGraph(const Hypergraph& hypergraph,
+                                         const LouvainEdgeWeight edge_weight_type) :
+    _hypergraph(&hypergraph),
+    _edge_weight_type(edge_weight_type),
+    _num_hypernodes(hypergraph.initialNumNodes()),
+    _num_nodes(hypergraph.initialNumNodes() + hypergraph.initialNumEdges()),
+    _num_arcs(2 * hypergraph.initialNumPins()),
+    _total_volume(0),
+    _max_degree(0),
+    _node_volumes() {
+    if ( edge_weight_type != LouvainEdgeWeight::uniform &&
+         edge_weight_type != LouvainEdgeWeight::non_uniform &&
+         edge_weight_type != LouvainEdgeWeight::degree ) {
+      ERROR("No valid louvain edge weight");
+    }
+    _node_volumes.resize("Preprocessing", "node_volumes", _num_nodes);
+
+    // node volumes are summed up in the same order as in the explicit star expansion
+    tbb::enumerable_thread_specific<size_t> local_max_degree(0);
+    tbb::parallel_for(0U, NodeID(numNodes()), [&](const NodeID u) {
+      ArcWeight x = 0.0;
+      for ( const Arc& arc : arcsOf(u) ) {
+        x += arc.weight;
+      }
+      _node_volumes[u] = x;
+      local_max_degree.local() = std::max(local_max_degree.local(), degree(u));
+    });
+    _max_degree = local_max_degree.combine([&](const size_t& lhs, const size_t& rhs) {
+      return std::max(lhs, rhs);
+    });
+
+    auto aggregate_volume = [&](const tbb::blocked_range<NodeID>& r, ArcWeight partial_volume) -> ArcWeight {
+      for (NodeID u = r.begin(); u < r.end(); ++u) {
+        partial_volume += nodeVolume(u);
+      }
+      return partial_volume;
+    };
+    auto r = tbb::blocked_range<NodeID>(0U, numNodes(), 1000);
+    _total_volume = tbb::parallel_deterministic_reduce(r, 0.0, aggregate_volume, std::plus<>());
+  }
+
+  bool StarExpansionGraph::canBeUsed(const bool verbose) const {
+    const bool result = _hypergraph && _node_volumes.size() >= numNodes();
+    if (verbose && !result) {
+      LOG << "The star expansion is not initialized or its node volumes were moved.";
+    }
+    return result;
+  }
+
+  Graph StarExpansionGraph::contract(Clustering& communities) const {
+    ASSERT(canBeUsed());
+    ASSERT(_num_nodes == communities.size());
+    return Graph::contract_low_memory(*this, communities);
+  }
+
+} // namespace mt_kahypar::ds
@@ -0,0 +1,277 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2021 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include <iterator>
+#include <optional>
+#include <boost/range/irange.hpp>
+
+#include "mt-kahypar/definitions.h"
+#include "mt-kahypar/datastructures/array.h"
+#include "mt-kahypar/datastructures/graph.h"
+#include "mt-kahypar/datastructures/hypergraph_common.h"
+#include "mt-kahypar/partition/context_enum_classes.h"
+#include "mt-kahypar/utils/range.h"
+
+namespace mt_kahypar {
+namespace ds {
+
+/*!
+ * Implicit star expansion of a hypergraph.
+ *
+ * Exposes the same read-only interface as the Graph that is constructed via
+ * Graph(hypergraph, edge_weight_type, false), but the arcs are not materialized.
+ * Node u < n corresponds to hypernode u and node n + e to hyperedge e. The arcs
+ * of a hypernode are read from incidentEdges(u), the arcs of a hyperedge from
+ * pins(e), and the arc weights are computed on-the-fly. Only the node volumes
+ * are stored. Arcs and volumes are identical to the ones of the explicit
+ * bipartite graph (including the summation order of the volumes).
+ *
+ * The Louvain method runs local moving on the implicit star expansion and
+ * materializes a Graph when it contracts the first level.
+ */
+class StarExpansionGraph {
+
+ public:
+  /*!
+   * Iterator over the arcs of a node of the star expansion. The iterator
+   * either wraps the incident nets of a hypernode or the pins of a hyperedge.
+   * The arcs are computed when the iterator is dereferenced.
+   */
+  class ArcIterator {
+    // Array::const_iterator is const-qualified
+    using IncidentNetsIterator = std::remove_const_t<typename Hypergraph::IncidentNetsIterator>;
+    using IncidenceIterator = std::remove_const_t<typename Hypergraph::IncidenceIterator>;
+
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Arc;
+    using reference = Arc;
+    using pointer = const Arc*;
+    using difference_type = std::ptrdiff_t;
+
+    // ! Iterator over the incident nets of hypernode u
+    static ArcIterator ofHypernode(const StarExpansionGraph* graph,
+                                   const NodeID u,
+                                   const IncidentNetsIterator& it) {
+      ArcIterator arc_it(graph, u);
+      arc_it._net_it.emplace(it);
+      return arc_it;
+    }
+
+    // ! Iterator over the pins of the hyperedge that corresponds to node u
+    static ArcIterator ofHyperedge(const StarExpansionGraph* graph,
+                                   const NodeID u,
+                                   const IncidenceIterator& it) {
+      ArcIterator arc_it(graph, u);
+      arc_it._pin_it.emplace(it);
+      return arc_it;
+    }
+
+    Arc operator* () const {
+      if ( _net_it ) {
+        const HyperedgeID he = *_net_it.value();
+        return Arc(he + _graph->_num_hypernodes, _graph->arcWeight(he, _source));
+      } else {
+        ASSERT(_pin_it);
+        const HypernodeID pin = *_pin_it.value();
+        return Arc(pin, _graph->arcWeight(_source - _graph->_num_hypernodes, pin));
+      }
+    }
+
+    ArcIterator & operator++ () {
+      if ( _net_it ) {
+        ++_net_it.value();
+      } else {
+        ++_pin_it.value();
+      }
+      return *this;
+    }
+
+    ArcIterator operator++ (int) {
+      ArcIterator copy = *this;
+      operator++ ();
+      return copy;
+    }
+
+    bool operator!= (const ArcIterator& rhs) const {
+      return !operator==(rhs);
+    }
+
+    bool operator== (const ArcIterator& rhs) const {
+      ASSERT(_source == rhs._source);
+      // some hypergraph iterators only provide non-const comparison operators
+      if ( _net_it ) {
+        IncidentNetsIterator it = _net_it.value();
+        return it == rhs._net_it.value();
+      } else {
+        IncidenceIterator it = _pin_it.value();
+        return it == rhs._pin_it.value();
+      }
+    }
+
+   private:
+    const StarExpansionGraph* _graph;
+    NodeID _source;
+    // Not all hypergraph iterators are default constructible
+    std::optional<IncidentNetsIterator> _net_it;
+    std::optional<IncidenceIterator> _pin_it;
+
+    ArcIterator(const StarExpansionGraph* graph, const NodeID u) :
+      _graph(graph),
+      _source(u),
+      _net_it(),
+      _pin_it() { }
+  };
+
+  StarExpansionGraph(const Hypergraph& hypergraph, const LouvainEdgeWeight edge_weight_type);
+
+  StarExpansionGraph(const StarExpansionGraph&) = delete;
+  StarExpansionGraph & operator= (const StarExpansionGraph &) = delete;
+
+  StarExpansionGraph(StarExpansionGraph&& other) = default;
+  StarExpansionGraph & operator= (StarExpansionGraph&& other) = default;
+
+  // ! Number of nodes in the star expansion (hypernodes + hyperedges)
+  size_t numNodes() const {
+    return _num_nodes;
+  }
+
+  // ! Number of arcs in the star expansion
+  size_t numArcs() const {
+    return _num_arcs;
+  }
+
+  // ! Iterator over all nodes of the graph
+  auto nodes() const {
+    return boost::irange<NodeID>(0, static_cast<NodeID>(numNodes()));
+  }
+
+  // ! Iterator over all adjacent vertices of u
+  // ! If 'n' is set, then only an iterator over the first n elements is returned
+  IteratorRange<ArcIterator> arcsOf(const NodeID u,
+                                    const size_t n = std::numeric_limits<size_t>::max()) const {
+    ASSERT(u < _num_nodes);
+    if ( u < _num_hypernodes ) {
+      auto range = _hypergraph->incidentEdges(u);
+      auto end = range.end();
+      if ( n < degree(u) ) {
+        end = std::next(range.begin(), n);
+      }
+      return IteratorRange<ArcIterator>(ArcIterator::ofHypernode(this, u, range.begin()),
+                                        ArcIterator::ofHypernode(this, u, end));
+    } else {
+      auto range = _hypergraph->pins(u - _num_hypernodes);
+      auto end = range.end();
+      if ( n < degree(u) ) {
+        end = std::next(range.begin(), n);
+      }
+      return IteratorRange<ArcIterator>(ArcIterator::ofHyperedge(this, u, range.begin()),
+                                        ArcIterator::ofHyperedge(this, u, end));
+    }
+  }
+
+  // ! Degree of vertex u
+  size_t degree(const NodeID u) const {
+    ASSERT(u < _num_nodes);
+    return u < _num_hypernodes ? _hypergraph->nodeDegree(u) :
+      _hypergraph->edgeSize(u - _num_hypernodes);
+  }
+
+  // ! Maximum degree of a vertex
+  size_t max_degree() const {
+    return _max_degree;
+  }
+
+  // ! Total Volume of the graph
+  ArcWeight totalVolume() const {
+    return _total_volume;
+  }
+
+  // ! Node volume of vertex u
+  ArcWeight nodeVolume(const NodeID u) const {
+    ASSERT(u < _num_nodes);
+    return _node_volumes[u];
+  }
+
+  // ! Projects the clustering of the star expansion to the hypergraph
+  void restrictClusteringToHypernodes(const Hypergraph& hg, ds::Clustering& C) const {
+    C.resize(hg.initialNumNodes());
+  }
+
+  bool canBeUsed(const bool verbose = true) const;
+
+  /*!
+   * Contracts the star expansion based on the community structure passed as
+   * argument and materializes the coarse graph. Uses the same algorithm as
+   * Graph::contract_low_memory(...), since there is no adjacency array that
+   * could be reused for the coarse graph.
+   */
+  Graph contract(Clustering& communities) const;
+
+ private:
+  // ! Weight of the arc between hyperedge he and hypernode hn (in both directions)
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE ArcWeight arcWeight(const HyperedgeID he,
+                                                         const HypernodeID hn) const {
+    const ArcWeight edge_weight = static_cast<ArcWeight>(_hypergraph->edgeWeight(he));
+    switch ( _edge_weight_type ) {
+      case LouvainEdgeWeight::uniform:
+        return edge_weight;
+      case LouvainEdgeWeight::non_uniform:
+        return edge_weight / static_cast<ArcWeight>(_hypergraph->edgeSize(he));
+      case LouvainEdgeWeight::degree:
+        return edge_weight * (static_cast<ArcWeight>(_hypergraph->nodeDegree(hn)) /
+                              static_cast<ArcWeight>(_hypergraph->edgeSize(he)));
+      default:
+        return edge_weight;
+    }
+  }
+
+  // ! Underlying hypergraph
+  const Hypergraph* _hypergraph;
+  // ! Edge weight function of the star expansion
+  LouvainEdgeWeight _edge_weight_type;
+  // ! Number of hypernodes (= ID of the first hyperedge node)
+  NodeID _num_hypernodes;
+  // ! Number of nodes
+  size_t _num_nodes;
+  // ! Number of arcs
+  size_t _num_arcs;
+  // ! Total volume of the graph (= sum of arc weights)
+  ArcWeight _total_volume;
+  // ! Maximum degree of a node
+  size_t _max_degree;
+  // ! Node Volumes (= sum of arc weights for each node)
+  ds::Array<ArcWeight> _node_volumes;
+};
+
+}  // namespace ds
+
+// expose
+using StarExpansionGraph = ds::StarExpansionGraph;
+
+}  // namespace mt_kahypar
@@ -46,7 +46,7 @@ namespace mt_kahypar::ds {
    *
    * \param communities Community structure that should be contracted
    */
-  StaticGraph StaticGraph::contract(parallel::scalable_vector<HypernodeID>& communities) {
+  StaticGraph StaticGraph::contract(parallel::scalable_vector<HypernodeID>& communities, const bool) {
     ASSERT(communities.size() == _num_nodes);
 
     if ( !_tmp_contraction_buffer ) {
@@ -712,8 +712,10 @@ class StaticGraph {
    * community label (given in 'communities') to a vertex in the coarse hypergraph.
    *
    * \param communities Community structure that should be contracted
+   * \param counting_sort Only used by the static hypergraph (ignored)
    */
-  StaticGraph contract(parallel::scalable_vector<HypernodeID>& communities);
+  StaticGraph contract(parallel::scalable_vector<HypernodeID>& communities,
+                       const bool counting_sort = false);
 
   bool registerContraction(const HypernodeID, const HypernodeID) {
     ERROR("registerContraction(u, v) is not supported in static graph");
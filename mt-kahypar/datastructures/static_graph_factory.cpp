@@ -28,6 +28,8 @@
 
 #include "static_graph_factory.h"
 
+#include <stdexcept>
+
 #include <tbb/parallel_for.h>
 #include <tbb/parallel_invoke.h>
 
@@ -77,7 +79,7 @@ namespace mt_kahypar::ds {
     edges.reserve(num_edges);
     for (const auto& e : edge_vector) {
       if (e.size() != 2) {
-        ERROR("Using graph data structure; but the input hypergraph is not a graph.");
+        throw std::invalid_argument("Using graph data structure; but the input hypergraph is not a graph.");
       }
       edges.push_back({e[0], e[1]});
     }
@@ -27,12 +27,15 @@
 
 #include "static_hypergraph.h"
 
+#include "mt-kahypar/parallel/parallel_counting_sort.h"
 #include "mt-kahypar/parallel/parallel_prefix_sum.h"
+#include "mt-kahypar/parallel/tbb_initializer.h"
 #include "mt-kahypar/datastructures/concurrent_bucket_map.h"
 #include "mt-kahypar/utils/timer.h"
 #include "mt-kahypar/utils/memory_tree.h"
 
 #include <tbb/parallel_reduce.h>
+#include <tbb/parallel_sort.h>
 
 namespace mt_kahypar::ds {
 
@@ -48,6 +51,15 @@ namespace mt_kahypar::ds {
     bool valid = false;
   };
 
+  /*!
+  * Pin of a hyperedge in the contracted hypergraph (used by the counting
+  * sort contraction).
+  */
+  struct ContractedPin {
+    HypernodeID hn;
+    HyperedgeID he;
+  };
+
   /*!
    * Contracts a given community structure. All vertices with the same label
    * are collapsed into the same vertex. The resulting single-pin and parallel
@@ -57,7 +69,8 @@ namespace mt_kahypar::ds {
    *
    * \param communities Community structure that should be contracted
    */
-  StaticHypergraph StaticHypergraph::contract(parallel::scalable_vector<HypernodeID>& communities) {
+  StaticHypergraph StaticHypergraph::contract(parallel::scalable_vector<HypernodeID>& communities,
+                                              const bool counting_sort) {
 
     ASSERT(communities.size() == _num_hypernodes);
 
@@ -145,153 +158,175 @@ namespace mt_kahypar::ds {
     // as invalid. All incident nets of vertices that are collapsed into one vertex in the coarse
     // graph are also aggregate in a consecutive memory range and duplicates are removed. Note
     // that parallel and single-pin hyperedges are not removed from the incident nets (will be done
-    // in a postprocessing step).
+    // in a postprocessing step). If counting_sort is set, the pins and incident nets are
+    // contracted with contractWithCountingSort(...) instead.
     auto cs2 = [](const HypernodeID x) { return x * x; };
     ConcurrentBucketMap<ContractedHyperedgeInformation> hyperedge_hash_map;
     hyperedge_hash_map.reserve_for_estimated_number_of_insertions(_num_hyperedges);
-    tbb::parallel_invoke([&] {
-      // Contract Hyperedges
-      tbb::parallel_for(ID(0), _num_hyperedges, [&](const HyperedgeID& he) {
-        if ( edgeIsEnabled(he) ) {
-          // Copy hyperedge and pins to temporary buffer
-          const Hyperedge& e = _hyperedges[he];
-          ASSERT(static_cast<size_t>(he) < tmp_hyperedges.size());
-          ASSERT(e.firstInvalidEntry() <= tmp_incidence_array.size());
-          tmp_hyperedges[he] = e;
-          valid_hyperedges[he] = 1;
-
-          // Map pins to vertex ids in coarse graph
-          const size_t incidence_array_start = tmp_hyperedges[he].firstEntry();
-          const size_t incidence_array_end = tmp_hyperedges[he].firstInvalidEntry();
-          for ( size_t pos = incidence_array_start; pos < incidence_array_end; ++pos ) {
-            const HypernodeID pin = _incidence_array[pos];
-            ASSERT(pos < tmp_incidence_array.size());
-            tmp_incidence_array[pos] = map_to_coarse_hypergraph(pin);
-          }
-
-          // Remove duplicates and disabled vertices
-          auto first_entry_it = tmp_incidence_array.begin() + incidence_array_start;
-          std::sort(first_entry_it, tmp_incidence_array.begin() + incidence_array_end);
-          auto first_invalid_entry_it = std::unique(first_entry_it, tmp_incidence_array.begin() + incidence_array_end);
-          while ( first_entry_it != first_invalid_entry_it && *(first_invalid_entry_it - 1) == kInvalidHypernode ) {
-            --first_invalid_entry_it;
-          }
 
-          // Update size of hyperedge in temporary hyperedge buffer
-          const size_t contracted_size = std::distance(
-                  tmp_incidence_array.begin() + incidence_array_start, first_invalid_entry_it);
-          tmp_hyperedges[he].setSize(contracted_size);
+    // Inserts a contracted hyperedge into the hash map used for parallel hyperedge
+    // detection or marks it as invalid, if it becomes a single-pin hyperedge
+    auto insert_contracted_hyperedge = [&](const HyperedgeID he) {
+      const size_t incidence_array_start = tmp_hyperedges[he].firstEntry();
+      const size_t contracted_size = tmp_hyperedges[he].size();
+      if ( contracted_size > 1 ) {
+        // Compute hash of contracted hyperedge
+        size_t footprint = kEdgeHashSeed;
+        for ( size_t pos = incidence_array_start; pos < incidence_array_start + contracted_size; ++pos ) {
+          footprint += cs2(tmp_incidence_array[pos]);
+        }
+        hyperedge_hash_map.insert(footprint,
+                                  ContractedHyperedgeInformation{ he, footprint, contracted_size, true });
+      } else {
+        // Hyperedge becomes a single-pin hyperedge
+        valid_hyperedges[he] = 0;
+        tmp_hyperedges[he].disable();
+      }
+    };
 
+    if ( counting_sort && _num_pins <= std::numeric_limits<uint32_t>::max() ) {
+      contractWithCountingSort(communities, num_hypernodes);
+      tbb::parallel_for(ID(0), _num_hyperedges, [&](const HyperedgeID& he) {
+        if ( valid_hyperedges[he] ) {
+          insert_contracted_hyperedge(he);
+        }
+      });
+    } else {
+      tbb::parallel_invoke([&] {
+        // Contract Hyperedges
+        tbb::parallel_for(ID(0), _num_hyperedges, [&](const HyperedgeID& he) {
+          if ( edgeIsEnabled(he) ) {
+            // Copy hyperedge and pins to temporary buffer
+            const Hyperedge& e = _hyperedges[he];
+            ASSERT(static_cast<size_t>(he) < tmp_hyperedges.size());
+            ASSERT(e.firstInvalidEntry() <= tmp_incidence_array.size());
+            tmp_hyperedges[he] = e;
+            valid_hyperedges[he] = 1;
+
+            // Map pins to vertex ids in coarse graph
+            const size_t incidence_array_start = tmp_hyperedges[he].firstEntry();
+            const size_t incidence_array_end = tmp_hyperedges[he].firstInvalidEntry();
+            for ( size_t pos = incidence_array_start; pos < incidence_array_end; ++pos ) {
+              const HypernodeID pin = _incidence_array[pos];
+              ASSERT(pos < tmp_incidence_array.size());
+              tmp_incidence_array[pos] = map_to_coarse_hypergraph(pin);
+            }
 
-          if ( contracted_size > 1 ) {
-            // Compute hash of contracted hyperedge
-            size_t footprint = kEdgeHashSeed;
-            for ( size_t pos = incidence_array_start; pos < incidence_array_start + contracted_size; ++pos ) {
-              footprint += cs2(tmp_incidence_array[pos]);
+            // Remove duplicates and disabled vertices
+            auto first_entry_it = tmp_incidence_array.begin() + incidence_array_start;
+            std::sort(first_entry_it, tmp_incidence_array.begin() + incidence_array_end);
+            auto first_invalid_entry_it = std::unique(first_entry_it, tmp_incidence_array.begin() + incidence_array_end);
+            while ( first_entry_it != first_invalid_entry_it && *(first_invalid_entry_it - 1) == kInvalidHypernode ) {
+              --first_invalid_entry_it;
             }
-            hyperedge_hash_map.insert(footprint,
-                                      ContractedHyperedgeInformation{ he, footprint, contracted_size, true });
+
+            // Update size of hyperedge in temporary hyperedge buffer
+            const size_t contracted_size = std::distance(
+                    tmp_incidence_array.begin() + incidence_array_start, first_invalid_entry_it);
+            tmp_hyperedges[he].setSize(contracted_size);
+            insert_contracted_hyperedge(he);
           } else {
-            // Hyperedge becomes a single-pin hyperedge
             valid_hyperedges[he] = 0;
-            tmp_hyperedges[he].disable();
           }
-        } else {
-          valid_hyperedges[he] = 0;
-        }
-      });
-    }, [&] {
-      // Contract Incident Nets
-      // Compute start position the incident nets of a coarse vertex in the
-      // temporary incident nets array with a parallel prefix sum
-      parallel::scalable_vector<parallel::IntegralAtomicWrapper<size_t>> tmp_incident_nets_pos;
-      parallel::TBBPrefixSum<parallel::IntegralAtomicWrapper<size_t>, Array>
-              tmp_incident_nets_prefix_sum(tmp_num_incident_nets);
-      tbb::parallel_invoke([&] {
-        tbb::parallel_scan(tbb::blocked_range<size_t>(
-                0UL, UI64(num_hypernodes)), tmp_incident_nets_prefix_sum);
+        });
       }, [&] {
-        tmp_incident_nets_pos.assign(num_hypernodes, parallel::IntegralAtomicWrapper<size_t>(0));
-      });
-
-      // Write the incident nets of each contracted vertex to the temporary incident net array
-      doParallelForAllNodes([&](const HypernodeID& hn) {
-        const HypernodeID coarse_hn = map_to_coarse_hypergraph(hn);
-        const HyperedgeID node_degree = nodeDegree(hn);
-        size_t incident_nets_pos = tmp_incident_nets_prefix_sum[coarse_hn] +
-                                   tmp_incident_nets_pos[coarse_hn].fetch_add(node_degree);
-        ASSERT(incident_nets_pos + node_degree <= tmp_incident_nets_prefix_sum[coarse_hn + 1]);
-        memcpy(tmp_incident_nets.data() + incident_nets_pos,
-               _incident_nets.data() + _hypernodes[hn].firstEntry(),
-               sizeof(HyperedgeID) * node_degree);
-      });
+        // Contract Incident Nets
+        // Compute start position the incident nets of a coarse vertex in the
+        // temporary incident nets array with a parallel prefix sum
+        parallel::scalable_vector<parallel::IntegralAtomicWrapper<size_t>> tmp_incident_nets_pos;
+        parallel::TBBPrefixSum<parallel::IntegralAtomicWrapper<size_t>, Array>
+                tmp_incident_nets_prefix_sum(tmp_num_incident_nets);
+        tbb::parallel_invoke([&] {
+          tbb::parallel_scan(tbb::blocked_range<size_t>(
+                  0UL, UI64(num_hypernodes)), tmp_incident_nets_prefix_sum);
+        }, [&] {
+          tmp_incident_nets_pos.assign(num_hypernodes, parallel::IntegralAtomicWrapper<size_t>(0));
+        });
 
-      // Setup temporary hypernodes
-      std::mutex high_degree_vertex_mutex;
-      parallel::scalable_vector<HypernodeID> high_degree_vertices;
-      tbb::parallel_for(ID(0), num_hypernodes, [&](const HypernodeID& coarse_hn) {
-        // Remove duplicates
-        const size_t incident_nets_start = tmp_incident_nets_prefix_sum[coarse_hn];
-        const size_t incident_nets_end = tmp_incident_nets_prefix_sum[coarse_hn + 1];
-        const size_t tmp_degree = incident_nets_end - incident_nets_start;
-        if ( tmp_degree <= HIGH_DEGREE_CONTRACTION_THRESHOLD ) {
-          std::sort(tmp_incident_nets.begin() + incident_nets_start,
-                    tmp_incident_nets.begin() + incident_nets_end);
-          auto first_invalid_entry_it = std::unique(tmp_incident_nets.begin() + incident_nets_start,
-                                                    tmp_incident_nets.begin() + incident_nets_end);
-
-          // Setup pointers to temporary incident nets
-          const size_t contracted_size = std::distance(tmp_incident_nets.begin() + incident_nets_start,
-                                                       first_invalid_entry_it);
-          tmp_hypernodes[coarse_hn].setSize(contracted_size);
-        } else {
-          std::lock_guard<std::mutex> lock(high_degree_vertex_mutex);
-          high_degree_vertices.push_back(coarse_hn);
-        }
-        tmp_hypernodes[coarse_hn].setWeight(hn_weights[coarse_hn]);
-        tmp_hypernodes[coarse_hn].setFirstEntry(incident_nets_start);
-      });
+        // Write the incident nets of each contracted vertex to the temporary incident net array
+        doParallelForAllNodes([&](const HypernodeID& hn) {
+          const HypernodeID coarse_hn = map_to_coarse_hypergraph(hn);
+          const HyperedgeID node_degree = nodeDegree(hn);
+          size_t incident_nets_pos = tmp_incident_nets_prefix_sum[coarse_hn] +
+                                     tmp_incident_nets_pos[coarse_hn].fetch_add(node_degree);
+          ASSERT(incident_nets_pos + node_degree <= tmp_incident_nets_prefix_sum[coarse_hn + 1]);
+          memcpy(tmp_incident_nets.data() + incident_nets_pos,
+                 _incident_nets.data() + _hypernodes[hn].firstEntry(),
+                 sizeof(HyperedgeID) * node_degree);
+        });
 
-      if ( !high_degree_vertices.empty() ) {
-        // High degree vertices are treated special, because sorting and afterwards
-        // removing duplicates can become a major sequential bottleneck. Therefore,
-        // we distribute the incident nets of a high degree vertex into our concurrent
-        // bucket map. As a result all equal incident nets reside in the same bucket
-        // afterwards. In a second step, we process each bucket in parallel and apply
-        // for each bucket the duplicate removal procedure from above.
-        ConcurrentBucketMap<HyperedgeID> duplicate_incident_nets_map;
-        for ( const HypernodeID& coarse_hn : high_degree_vertices ) {
+        // Setup temporary hypernodes
+        std::mutex high_degree_vertex_mutex;
+        parallel::scalable_vector<HypernodeID> high_degree_vertices;
+        tbb::parallel_for(ID(0), num_hypernodes, [&](const HypernodeID& coarse_hn) {
+          // Remove duplicates
           const size_t incident_nets_start = tmp_incident_nets_prefix_sum[coarse_hn];
           const size_t incident_nets_end = tmp_incident_nets_prefix_sum[coarse_hn + 1];
           const size_t tmp_degree = incident_nets_end - incident_nets_start;
+          if ( tmp_degree <= HIGH_DEGREE_CONTRACTION_THRESHOLD ) {
+            std::sort(tmp_incident_nets.begin() + incident_nets_start,
+                      tmp_incident_nets.begin() + incident_nets_end);
+            auto first_invalid_entry_it = std::unique(tmp_incident_nets.begin() + incident_nets_start,
+                                                      tmp_incident_nets.begin() + incident_nets_end);
+
+            // Setup pointers to temporary incident nets
+            const size_t contracted_size = std::distance(tmp_incident_nets.begin() + incident_nets_start,
+                                                         first_invalid_entry_it);
+            tmp_hypernodes[coarse_hn].setSize(contracted_size);
+          } else {
+            std::lock_guard<std::mutex> lock(high_degree_vertex_mutex);
+            high_degree_vertices.push_back(coarse_hn);
+          }
+          tmp_hypernodes[coarse_hn].setWeight(hn_weights[coarse_hn]);
+          tmp_hypernodes[coarse_hn].setFirstEntry(incident_nets_start);
+        });
 
-          // Insert incident nets into concurrent bucket map
-          duplicate_incident_nets_map.reserve_for_estimated_number_of_insertions(tmp_degree);
-          tbb::parallel_for(incident_nets_start, incident_nets_end, [&](const size_t pos) {
-            HyperedgeID he = tmp_incident_nets[pos];
-            duplicate_incident_nets_map.insert(he, std::move(he));
-          });
-
-          // Process each bucket in parallel and remove duplicates
-          std::atomic<size_t> incident_nets_pos(incident_nets_start);
-          tbb::parallel_for(0UL, duplicate_incident_nets_map.numBuckets(), [&](const size_t bucket) {
-            auto& incident_net_bucket = duplicate_incident_nets_map.getBucket(bucket);
-            std::sort(incident_net_bucket.begin(), incident_net_bucket.end());
-            auto first_invalid_entry_it = std::unique(incident_net_bucket.begin(), incident_net_bucket.end());
-            const size_t bucket_degree = std::distance(incident_net_bucket.begin(), first_invalid_entry_it);
-            const size_t tmp_incident_nets_pos = incident_nets_pos.fetch_add(bucket_degree);
-            memcpy(tmp_incident_nets.data() + tmp_incident_nets_pos,
-                   incident_net_bucket.data(), sizeof(HyperedgeID) * bucket_degree);
-            duplicate_incident_nets_map.clear(bucket);
-          });
-
-          // Update number of incident nets of high degree vertex
-          const size_t contracted_size = incident_nets_pos.load() - incident_nets_start;
-          tmp_hypernodes[coarse_hn].setSize(contracted_size);
+        if ( !high_degree_vertices.empty() ) {
+          // High degree vertices are treated special, because sorting and afterwards
+          // removing duplicates can become a major sequential bottleneck. Therefore,
+          // we distribute the incident nets of a high degree vertex into our concurrent
+          // bucket map. As a result all equal incident nets reside in the same bucket
+          // afterwards. In a second step, we process each bucket in parallel and apply
+          // for each bucket the duplicate removal procedure from above.
+          ConcurrentBucketMap<HyperedgeID> duplicate_incident_nets_map;
+          for ( const HypernodeID& coarse_hn : high_degree_vertices ) {
+            const size_t incident_nets_start = tmp_incident_nets_prefix_sum[coarse_hn];
+            const size_t incident_nets_end = tmp_incident_nets_prefix_sum[coarse_hn + 1];
+            const size_t tmp_degree = incident_nets_end - incident_nets_start;
+
+            // Insert incident nets into concurrent bucket map
+            duplicate_incident_nets_map.reserve_for_estimated_number_of_insertions(tmp_degree);
+            tbb::parallel_for(incident_nets_start, incident_nets_end, [&](const size_t pos) {
+              HyperedgeID he = tmp_incident_nets[pos];
+              duplicate_incident_nets_map.insert(he, std::move(he));
+            });
+
+            // Process each bucket in parallel and remove duplicates
+            std::atomic<size_t> incident_nets_pos(incident_nets_start);
+            tbb::parallel_for(0UL, duplicate_incident_nets_map.numBuckets(), [&](const size_t bucket) {
+              auto& incident_net_bucket = duplicate_incident_nets_map.getBucket(bucket);
+              std::sort(incident_net_bucket.begin(), incident_net_bucket.end());
+              auto first_invalid_entry_it = std::unique(incident_net_bucket.begin(), incident_net_bucket.end());
+              const size_t bucket_degree = std::distance(incident_net_bucket.begin(), first_invalid_entry_it);
+              const size_t tmp_incident_nets_pos = incident_nets_pos.fetch_add(bucket_degree);
+              memcpy(tmp_incident_nets.data() + tmp_incident_nets_pos,
+                     incident_net_bucket.data(), sizeof(HyperedgeID) * bucket_degree);
+              duplicate_incident_nets_map.clear(bucket);
+            });
+
+            // Update number of incident nets of high degree vertex. The order in which the
+            // buckets are written depends on the scheduling of the threads and the number of
+            // buckets on the hardware. We sort the incident nets such that they are in the
+            // same order as for all other vertices.
+            const size_t contracted_size = incident_nets_pos.load() - incident_nets_start;
+            tbb::parallel_sort(tmp_incident_nets.data() + incident_nets_start,
+                               tmp_incident_nets.data() + incident_nets_start + contracted_size);
+            tmp_hypernodes[coarse_hn].setSize(contracted_size);
+          }
+          duplicate_incident_nets_map.free();
         }
-        duplicate_incident_nets_map.free();
-      }
-    });
+      });
+    }
 
     // #################### STAGE 3 ####################
     // In the step before we aggregated hyperedges within a bucket data structure.
@@ -478,11 +513,121 @@ namespace mt_kahypar::ds {
     tbb::parallel_invoke( assign_communities, setup_hyperedges, setup_hypernodes);
 
     hypergraph._total_weight = _total_weight;   // didn't lose any vertices
+    // Contracted vertices and merged parallel hyperedges are weighted
+    hypergraph._has_unit_hypernode_weights.store(false);
+    hypergraph._has_unit_hyperedge_weights.store(false);
     hypergraph._tmp_contraction_buffer = _tmp_contraction_buffer;
     _tmp_contraction_buffer = nullptr;
     return hypergraph;
   }
 
+  /*!
+   * Alternative to stage 2 of contract(...) that does not use comparison-based sorting.
+   * All pins (he, coarse_hn) are stored in the order of the incidence array (sorted by
+   * hyperedge ID) and sorted by coarse_hn with a stable counting sort. Afterwards, the
+   * incident nets of each coarse vertex are sorted and duplicates are adjacent, which
+   * are removed with a linear scan. A second stable counting sort of the remaining pins
+   * by hyperedge ID yields the pins of each contracted hyperedge sorted by vertex ID
+   * and without duplicates.
+   *
+   * The result (in the temporary buffers) is the same as in stage 2 of contract(...),
+   * except that the first entry of a contracted hyperedge may change.
+   */
+  void StaticHypergraph::contractWithCountingSort(const parallel::scalable_vector<HypernodeID>& communities,
+                                                  const HypernodeID num_hypernodes) {
+    ASSERT(_tmp_contraction_buffer);
+    Array<Hypernode>& tmp_hypernodes = _tmp_contraction_buffer->tmp_hypernodes;
+    IncidentNets& tmp_incident_nets = _tmp_contraction_buffer->tmp_incident_nets;
+    Array<parallel::IntegralAtomicWrapper<HypernodeWeight>>& hn_weights =
+            _tmp_contraction_buffer->hn_weights;
+    Array<Hyperedge>& tmp_hyperedges = _tmp_contraction_buffer->tmp_hyperedges;
+    IncidenceArray& tmp_incidence_array = _tmp_contraction_buffer->tmp_incidence_array;
+    Array<size_t>& valid_hyperedges = _tmp_contraction_buffer->valid_hyperedges;
+
+    const size_t num_pins = _num_pins;
+    ASSERT(num_pins == _incidence_array.size());
+    ASSERT(num_pins <= tmp_incident_nets.size() && num_pins <= tmp_incidence_array.size());
+    ASSERT(_num_hyperedges == 0 || _hyperedges[_num_hyperedges - 1].firstInvalidEntry() == num_pins);
+    // The (hn, he) pairs are only required during this contraction and are
+    // released afterwards (in contrast to the other contraction buffers)
+    parallel::scalable_vector<ContractedPin> pins;
+    parallel::scalable_vector<ContractedPin> sorted_pins;
+    tbb::parallel_invoke([&] {
+      pins.resize(num_pins);
+    }, [&] {
+      sorted_pins.resize(num_pins);
+    });
+
+    // Pins of disabled hyperedges and disabled vertices are assigned to the additional
+    // bucket num_hypernodes (resp. _num_hyperedges) of the counting sorts
+    tbb::parallel_for(ID(0), _num_hyperedges, [&](const HyperedgeID& he) {
+      const Hyperedge& e = _hyperedges[he];
+      const bool is_enabled = edgeIsEnabled(he);
+      tmp_hyperedges[he] = e;
+      valid_hyperedges[he] = is_enabled ? 1 : 0;
+      for ( size_t pos = e.firstEntry(); pos < e.firstInvalidEntry(); ++pos ) {
+        const HypernodeID coarse_hn = is_enabled ? communities[_incidence_array[pos]] : kInvalidHypernode;
+        pins[pos] = ContractedPin { coarse_hn == kInvalidHypernode ? num_hypernodes : coarse_hn, he };
+      }
+    });
+
+    // The counting sort uses one bucket array per task. We bound the number of tasks
+    // such that the bucket arrays require not more memory than the pins.
+    const size_t num_threads = TBBInitializer::instance().total_number_of_threads();
+    auto num_tasks = [&](const size_t num_buckets) {
+      return std::max(std::min(num_threads, num_pins / num_buckets), 1UL);
+    };
+
+    // Sort pins by vertex ID in the coarse hypergraph
+    auto get_hypernode = [&](const ContractedPin& pin) { return pin.hn; };
+    const vec<uint32_t> hn_bounds = parallel::counting_sort(pins, sorted_pins,
+      num_hypernodes + 1, get_hypernode, num_tasks(num_hypernodes + 1));
+
+    // Remove duplicated incident nets and write the remaining pins to the input of the second counting sort
+    tbb::parallel_invoke([&] {
+      tbb::parallel_for(ID(0), num_hypernodes, [&](const HypernodeID& coarse_hn) {
+        const size_t incident_nets_start = hn_bounds[coarse_hn];
+        const size_t incident_nets_end = hn_bounds[coarse_hn + 1];
+        size_t contracted_size = 0;
+        for ( size_t pos = incident_nets_start; pos < incident_nets_end; ++pos ) {
+          const HyperedgeID he = sorted_pins[pos].he;
+          if ( contracted_size == 0 || tmp_incident_nets[incident_nets_start + contracted_size - 1] != he ) {
+            tmp_incident_nets[incident_nets_start + contracted_size] = he;
+            pins[incident_nets_start + contracted_size] = ContractedPin { coarse_hn, he };
+            ++contracted_size;
+          }
+        }
+        for ( size_t pos = incident_nets_start + contracted_size; pos < incident_nets_end; ++pos ) {
+          pins[pos] = ContractedPin { coarse_hn, _num_hyperedges };
+        }
+        tmp_hypernodes[coarse_hn].setFirstEntry(incident_nets_start);
+        tmp_hypernodes[coarse_hn].setSize(contracted_size);
+        tmp_hypernodes[coarse_hn].setWeight(hn_weights[coarse_hn]);
+      });
+    }, [&] {
+      tbb::parallel_for(UI64(hn_bounds[num_hypernodes]), num_pins, [&](const size_t pos) {
+        pins[pos] = ContractedPin { num_hypernodes, _num_hyperedges };
+      });
+    });
+
+    // Sort pins by hyperedge ID
+    auto get_hyperedge = [&](const ContractedPin& pin) { return pin.he; };
+    const vec<uint32_t> he_bounds = parallel::counting_sort(pins, sorted_pins,
+      _num_hyperedges + 1, get_hyperedge, num_tasks(_num_hyperedges + 1));
+
+    tbb::parallel_for(ID(0), _num_hyperedges, [&](const HyperedgeID& he) {
+      if ( valid_hyperedges[he] ) {
+        const size_t incidence_array_start = he_bounds[he];
+        const size_t incidence_array_end = he_bounds[he + 1];
+        for ( size_t pos = incidence_array_start; pos < incidence_array_end; ++pos ) {
+          tmp_incidence_array[pos] = sorted_pins[pos].hn;
+        }
+        tmp_hyperedges[he].setFirstEntry(incidence_array_start);
+        tmp_hyperedges[he].setSize(incidence_array_end - incidence_array_start);
+      }
+    });
+  }
+
 
   // ! Copy static hypergraph in parallel
   StaticHypergraph StaticHypergraph::copy(parallel_tag_t) const {
@@ -496,6 +641,8 @@ namespace mt_kahypar::ds {
     hypergraph._num_pins = _num_pins;
     hypergraph._total_degree = _total_degree;
     hypergraph._total_weight = _total_weight;
+    hypergraph._has_unit_hypernode_weights = _has_unit_hypernode_weights;
+    hypergraph._has_unit_hyperedge_weights = _has_unit_hyperedge_weights;
 
     tbb::parallel_invoke([&] {
       hypergraph._hypernodes.resize(_hypernodes.size());
@@ -531,6 +678,8 @@ namespace mt_kahypar::ds {
     hypergraph._num_pins = _num_pins;
     hypergraph._total_degree = _total_degree;
     hypergraph._total_weight = _total_weight;
+    hypergraph._has_unit_hypernode_weights = _has_unit_hypernode_weights;
+    hypergraph._has_unit_hyperedge_weights = _has_unit_hyperedge_weights;
 
     hypergraph._hypernodes.resize(_hypernodes.size());
     memcpy(hypergraph._hypernodes.data(), _hypernodes.data(),
@@ -409,6 +409,8 @@ class StaticHypergraph {
     _num_pins(0),
     _total_degree(0),
     _total_weight(0),
+    _has_unit_hypernode_weights(true),
+    _has_unit_hyperedge_weights(true),
     _hypernodes(),
     _incident_nets(),
     _hyperedges(),
@@ -429,6 +431,8 @@ class StaticHypergraph {
     _num_pins(other._num_pins),
     _total_degree(other._total_degree),
     _total_weight(other._total_weight),
+    _has_unit_hypernode_weights(other._has_unit_hypernode_weights),
+    _has_unit_hyperedge_weights(other._has_unit_hyperedge_weights),
     _hypernodes(std::move(other._hypernodes)),
     _incident_nets(std::move(other._incident_nets)),
     _hyperedges(std::move(other._hyperedges)),
@@ -448,6 +452,8 @@ class StaticHypergraph {
     _num_pins = other._num_pins;
     _total_degree = other._total_degree;
     _total_weight = other._total_weight;
+    _has_unit_hypernode_weights = other._has_unit_hypernode_weights;
+    _has_unit_hyperedge_weights = other._has_unit_hyperedge_weights;
     _hypernodes = std::move(other._hypernodes);
     _incident_nets = std::move(other._incident_nets);
     _hyperedges = std::move(other._hyperedges);
@@ -576,15 +582,26 @@ class StaticHypergraph {
 
   // ! Weight of a vertex
   HypernodeWeight nodeWeight(const HypernodeID u) const {
-    return hypernode(u).weight();
+    const bool has_unit_weights = _has_unit_hypernode_weights.load(std::memory_order_relaxed);
+    ASSERT(!has_unit_weights || hypernode(u).weight() == 1);
+    return has_unit_weights ? 1 : hypernode(u).weight();
   }
 
   // ! Sets the weight of a vertex
   void setNodeWeight(const HypernodeID u, const HypernodeWeight weight) {
     ASSERT(!hypernode(u).isDisabled(), "Hypernode" << u << "is disabled");
+    if ( weight != 1 && _has_unit_hypernode_weights.load(std::memory_order_relaxed) ) {
+      _has_unit_hypernode_weights.store(false, std::memory_order_relaxed);
+    }
     return hypernode(u).setWeight(weight);
   }
 
+  // ! Returns, whether all vertices have unit weight. In that case,
+  // ! nodeWeight(u) does not access the hypernode array.
+  bool hasUnitHypernodeWeights() const {
+    return _has_unit_hypernode_weights.load(std::memory_order_relaxed);
+  }
+
   // ! Degree of a hypernode
   HyperedgeID nodeDegree(const HypernodeID u) const {
     ASSERT(!hypernode(u).isDisabled(), "Hypernode" << u << "is disabled");
@@ -631,15 +648,26 @@ class StaticHypergraph {
   // ! Weight of a hyperedge
   HypernodeWeight edgeWeight(const HyperedgeID e) const {
     ASSERT(!hyperedge(e).isDisabled(), "Hyperedge" << e << "is disabled");
-    return hyperedge(e).weight();
+    const bool has_unit_weights = _has_unit_hyperedge_weights.load(std::memory_order_relaxed);
+    ASSERT(!has_unit_weights || hyperedge(e).weight() == 1);
+    return has_unit_weights ? 1 : hyperedge(e).weight();
   }
 
   // ! Sets the weight of a hyperedge
   void setEdgeWeight(const HyperedgeID e, const HyperedgeWeight weight) {
     ASSERT(!hyperedge(e).isDisabled(), "Hyperedge" << e << "is disabled");
+    if ( weight != 1 && _has_unit_hyperedge_weights.load(std::memory_order_relaxed) ) {
+      _has_unit_hyperedge_weights.store(false, std::memory_order_relaxed);
+    }
     return hyperedge(e).setWeight(weight);
   }
 
+  // ! Returns, whether all hyperedges have unit weight. In that case,
+  // ! edgeWeight(e) does not access the hyperedge array.
+  bool hasUnitHyperedgeWeights() const {
+    return _has_unit_hyperedge_weights.load(std::memory_order_relaxed);
+  }
+
   // ! Number of pins of a hyperedge
   HypernodeID edgeSize(const HyperedgeID e) const {
     ASSERT(!hyperedge(e).isDisabled(), "Hyperedge" << e << "is disabled");
@@ -686,8 +714,12 @@ class StaticHypergraph {
    * community label (given in 'communities') to a vertex in the coarse hypergraph.
    *
    * \param communities Community structure that should be contracted
+   * \param counting_sort If true, pins and incident nets are contracted with two stable
+   *        counting sorts instead of sorting the pins of each hyperedge and the incident
+   *        nets of each vertex (see contractWithCountingSort(...))
    */
-  StaticHypergraph contract(parallel::scalable_vector<HypernodeID>& communities);
+  StaticHypergraph contract(parallel::scalable_vector<HypernodeID>& communities,
+                            const bool counting_sort = false);
 
   bool registerContraction(const HypernodeID, const HypernodeID) {
     ERROR("registerContraction(u, v) is not supported in static hypergraph");
@@ -915,6 +947,11 @@ class StaticHypergraph {
     }
   }
 
+  // ! Contracts the pins and incident nets into the temporary contraction
+  // ! buffers with two stable counting sorts (see contract(...))
+  void contractWithCountingSort(const parallel::scalable_vector<HypernodeID>& communities,
+                                const HypernodeID num_hypernodes);
+
   // ! Number of hypernodes
   HypernodeID _num_hypernodes;
   // ! Number of removed hypernodes
@@ -933,6 +970,16 @@ class StaticHypergraph {
   HypernodeID _total_degree;
   // ! Total weight of hypergraph
   HypernodeWeight _total_weight;
+  // ! If true, all vertices have unit weight (e.g., the input hypergraph is unweighted)
+  // ! and the weights stored in the hypernodes are not accessed. Note that the flag
+  // ! is reset after the first contraction, since it creates weighted vertices.
+  // ! The flags are computed once during construction and can only be cleared
+  // ! afterwards by setNodeWeight(...) and setEdgeWeight(...), which may be called
+  // ! concurrently (hence the relaxed atomics).
+  parallel::AtomicWrapper<bool> _has_unit_hypernode_weights;
+  // ! If true, all hyperedges have unit weight and the weights stored
+  // ! in the hyperedges are not accessed
+  parallel::AtomicWrapper<bool> _has_unit_hyperedge_weights;
 
   // ! Hypernodes
   Array<Hypernode> _hypernodes;
@@ -29,12 +29,32 @@
 
 #include <tbb/parallel_for.h>
 #include <tbb/parallel_invoke.h>
+#include <tbb/parallel_reduce.h>
 
 #include "mt-kahypar/parallel/parallel_prefix_sum.h"
 #include "mt-kahypar/utils/timer.h"
 
 namespace mt_kahypar::ds {
 
+  namespace {
+    // ! Returns true, if no weights are given or all weights are one
+    template<typename Weight>
+    bool hasUnitWeights(const Weight* weights, const size_t size) {
+      if ( !weights ) {
+        return true;
+      }
+      return tbb::parallel_reduce(tbb::blocked_range<size_t>(0UL, size), true,
+        [&](const tbb::blocked_range<size_t>& range, bool unit) {
+          for ( size_t i = range.begin(); unit && i < range.end(); ++i ) {
+            unit = weights[i] == 1;
+          }
+          return unit;
+        }, [](const bool lhs, const bool rhs) {
+          return lhs && rhs;
+        });
+    }
+  } // namespace
+
   StaticHypergraph StaticHypergraphFactory::construct(
           const HypernodeID num_hypernodes,
           const HyperedgeID num_hyperedges,
@@ -144,7 +164,17 @@ namespace mt_kahypar::ds {
       hypergraph._community_ids.resize(num_hypernodes, 0);
     };
 
-    tbb::parallel_invoke(setup_hyperedges, setup_hypernodes, init_communities);
+    auto check_unit_weights = [&] {
+      // Unweighted inputs do not access the weights stored in the hypernodes and
+      // hyperedges until the first contraction creates weighted vertices
+      tbb::parallel_invoke([&] {
+        hypergraph._has_unit_hyperedge_weights.store(hasUnitWeights(hyperedge_weight, num_hyperedges));
+      }, [&] {
+        hypergraph._has_unit_hypernode_weights.store(hasUnitWeights(hypernode_weight, num_hypernodes));
+      });
+    };
+
+    tbb::parallel_invoke(setup_hyperedges, setup_hypernodes, init_communities, check_unit_weights);
 
     if (stable_construction_of_incident_edges) {
       // sort incident hyperedges of each node, so their ordering is independent of scheduling (and the same as a typical sequential implementation)
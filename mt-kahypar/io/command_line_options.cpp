@@ -106,6 +106,10 @@ namespace mt_kahypar {
              po::value<double>(&context.partition.large_hyperedge_size_threshold_factor)->value_name(
                      "<double>")->default_value(0.01),
              "Hyperedges larger than max(|V| * (this factor), p-smallest-maxnet-threshold) are removed before partitioning.")
+            ("maxnet-approximation",
+             po::value<bool>(&context.partition.approximate_large_hyperedges)->value_name("<bool>")->default_value(false),
+             "If true, large hyperedges (see maxnet-removal-factor) are not removed before partitioning.\n"
+             "Instead, their pin counts are maintained, but they are excluded from the gain cache.")
             ("maxnet-ignore",
              po::value<HyperedgeID>(&context.partition.ignore_hyperedge_size_threshold)->value_name(
                      "<uint64_t>")->default_value(1000),
@@ -164,11 +168,31 @@ namespace mt_kahypar {
             ("p-enable-community-detection",
              po::value<bool>(&context.preprocessing.use_community_detection)->value_name("<bool>")->default_value(true),
              "If true, community detection is used as preprocessing step to restrict contractions to densely coupled regions in coarsening phase")
+            ("p-cache-communities",
+             po::value<bool>(&context.preprocessing.cache_communities)->value_name("<bool>")->default_value(false),
+             "If true, the communities are stored in <graph-file>.community.cache and reused by subsequent runs "
+             "on the same input with the same community detection parameters.")
             #ifdef USE_GRAPH_PARTITIONER
             ("p-disable-community-detection-on-mesh-graphs",
              po::value<bool>(&context.preprocessing.disable_community_detection_for_mesh_graphs)->value_name("<bool>")->default_value(true),
              "If true, community detection is dynamically disabled for mesh graphs (as it is not effective for this type of graphs).")
             #endif
+            ("p-node-ordering",
+             po::value<std::string>()->value_name("<string>")->notifier(
+                     [&](const std::string& ordering) {
+                       context.preprocessing.node_ordering = nodeOrderingFromString(ordering);
+                     })->default_value("none"),
+             "Relabels vertices and nets before partitioning to improve the memory locality of the hypergraph.\n"
+             "The input hypergraph is released during partitioning and rebuilt afterwards:\n"
+             "- none\n"
+             "- bfs\n"
+             "- communities (requires community detection)")
+            ("p-contract-twin-vertices",
+             po::value<bool>(&context.preprocessing.contract_twin_vertices)->value_name("<bool>")->default_value(false),
+             "If true, vertices with identical sets of incident nets are contracted before partitioning.")
+            ("p-merge-identical-nets",
+             po::value<bool>(&context.preprocessing.merge_identical_nets)->value_name("<bool>")->default_value(false),
+             "If true, nets with identical pin sets are merged (their weights are summed up) before partitioning.")
             ("p-louvain-edge-weight-function",
              po::value<std::string>()->value_name("<string>")->notifier(
                      [&](const std::string& type) {
@@ -188,6 +212,11 @@ namespace mt_kahypar {
              po::value<bool>(&context.preprocessing.community_detection.low_memory_contraction)->value_name(
                      "<bool>")->default_value(false),
              "Maximum number of iterations over all nodes of one louvain pass")
+            ("p-louvain-implicit-star-expansion",
+             po::value<bool>(&context.preprocessing.community_detection.implicit_star_expansion)->value_name(
+                     "<bool>")->default_value(false),
+             "If true, the first level of the louvain method reads the star expansion of the hypergraph\n"
+             "directly from the hypergraph instead of constructing the bipartite graph.")
             ("p-louvain-min-vertex-move-fraction",
              po::value<long double>(&context.preprocessing.community_detection.min_vertex_move_fraction)->value_name(
                      "<long double>")->default_value(0.01),
@@ -280,10 +309,32 @@ namespace mt_kahypar {
              po::value<size_t>(&context.coarsening.vertex_degree_sampling_threshold)->value_name(
                      "<size_t>")->default_value(std::numeric_limits<size_t>::max()),
              "If set, then neighbors of a vertex are sampled during rating if its degree is greater than this threshold.")
+            ("c-large-net-sampling-threshold",
+             po::value<size_t>(&context.coarsening.large_net_sampling_threshold)->value_name(
+                     "<size_t>")->default_value(std::numeric_limits<size_t>::max()),
+             "If set, then only a random sample of the pins of a hyperedge is rated if its size is greater than this threshold.")
+            ("c-large-net-sample-size",
+             po::value<size_t>(&context.coarsening.large_net_sample_size)->value_name(
+                     "<size_t>")->default_value(1000),
+             "Number of pins that are sampled from a hyperedge whose size is greater than the large net sampling threshold.")
             ("c-num-sub-rounds",
              po::value<size_t>(&context.coarsening.num_sub_rounds_deterministic)->value_name(
                      "<size_t>")->default_value(16),
-             "Number of sub-rounds used for deterministic coarsening.");
+             "Number of sub-rounds used for deterministic coarsening.")
+            ("c-counting-sort-contraction",
+             po::value<bool>(&context.coarsening.counting_sort_contraction)->value_name(
+                     "<bool>")->default_value(false),
+             "If true, pins and incident nets are deduplicated with parallel counting sorts instead of\n"
+             "sorting the pins of each hyperedge and the incident nets of each vertex during contraction.")
+            ("c-two-hop-clustering",
+             po::value<bool>(&context.coarsening.use_two_hop_clustering)->value_name(
+                     "<bool>")->default_value(false),
+             "If true, vertices that remain unmatched in a clustering pass are clustered with other unmatched vertices "
+             "that share the same favorite neighbor (e.g., leaves of a star).")
+            ("c-two-hop-shrink-factor-threshold",
+             po::value<double>(&context.coarsening.two_hop_shrink_factor_threshold)->value_name(
+                     "<double>")->default_value(2.0),
+             "Two-hop clustering is only used if a clustering pass shrinks the hypergraph by less than this factor.");
     return options;
   }
 
@@ -341,6 +392,11 @@ namespace mt_kahypar {
                                 &context.initial_partitioning.refinement.deterministic_refinement.use_active_node_set))->value_name(
                      "<bool>")->default_value(true),
              "Number of sub-rounds for deterministic synchronous label propagation")
+            ((initial_partitioning ? "i-r-det-fm-sub-rounds" : "r-det-fm-sub-rounds"),
+             po::value<size_t>((!initial_partitioning ? &context.refinement.deterministic_refinement.num_sub_rounds_fm :
+                                &context.initial_partitioning.refinement.deterministic_refinement.num_sub_rounds_fm))->value_name(
+                     "<size_t>")->default_value(4),
+             "Number of synchronous sub-rounds of localized searches per round of deterministic FM")
             ((initial_partitioning ? "i-r-lp-rebalancing" : "r-lp-rebalancing"),
              po::value<bool>((!initial_partitioning ? &context.refinement.label_propagation.rebalancing :
                               &context.initial_partitioning.refinement.label_propagation.rebalancing))->value_name(
@@ -353,6 +409,13 @@ namespace mt_kahypar {
                       &context.initial_partitioning.refinement.label_propagation.hyperedge_size_activation_threshold))->value_name(
                      "<size_t>")->default_value(100),
              "LP refiner activates only neighbors of moved vertices that are part of hyperedges with a size less than this threshold")
+            ((initial_partitioning ? "i-r-lp-cache-block-size" : "r-lp-cache-block-size"),
+             po::value<size_t>((!initial_partitioning ? &context.refinement.label_propagation.cache_block_size :
+                                &context.initial_partitioning.refinement.label_propagation.cache_block_size))->value_name(
+                     "<size_t>")->default_value(0),
+             "If greater than zero, the LP refiner processes the active nodes sorted by ID in blocks of this size\n"
+             "(in random block order), prefetches the pin counts of the next node and activates the neighbors of\n"
+             "moved nodes after each block (0 = process active nodes in random order)")
             ((initial_partitioning ? "i-r-fm-type" : "r-fm-type"),
              po::value<std::string>()->value_name("<string>")->notifier(
                      [&, initial_partitioning](const std::string& type) {
@@ -367,6 +430,7 @@ namespace mt_kahypar {
              "- fm_gain_cache_on_demand\n"
              "- fm_gain_delta\n"
              "- fm_recompute_gain\n"
+             "- deterministic\n"
              "- do_nothing")
             ((initial_partitioning ? "i-r-fm-multitry-rounds" : "r-fm-multitry-rounds"),
              po::value<size_t>((initial_partitioning ? &context.initial_partitioning.refinement.fm.multitry_rounds :
@@ -377,6 +441,18 @@ namespace mt_kahypar {
                               &context.refinement.fm.perform_moves_global))->value_name("<bool>")->default_value(false),
              "If true, then all moves performed during FM are immediately visible to other searches.\n"
              "Otherwise, only move sequences that yield an improvement are applied to the global view of the partition.")
+            ((initial_partitioning ? "i-r-fm-delta-memory-fraction" : "r-fm-delta-memory-fraction"),
+             po::value<double>((initial_partitioning ? &context.initial_partitioning.refinement.fm.delta_memory_fraction :
+                                &context.refinement.fm.delta_memory_fraction))->value_name("<double>")->default_value(0.5),
+             "Fraction of the physical memory that can be used by the local delta partitions of all FM searches.\n"
+             "A search stops early if its delta partition exceeds its share of this memory.")
+            ((initial_partitioning ? "i-r-fm-bucket-pq-gain-range" : "r-fm-bucket-pq-gain-range"),
+             po::value<Gain>((initial_partitioning ? &context.initial_partitioning.refinement.fm.bucket_pq_gain_range :
+                              &context.refinement.fm.bucket_pq_gain_range))->value_name("<int>")->default_value(0),
+             "If the absolute gain of each move is bounded by this value (i.e., the maximum weighted degree\n"
+             "of the hypergraph), fm_gain_cache uses bucket queues instead of binary heaps as vertex priority queues.\n"
+             "The queues have one bucket per gain up to the maximum weighted degree. Larger gains are stored in\n"
+             "an overflow heap (0 = always use binary heaps).")
             ((initial_partitioning ? "i-r-fm-seed-nodes" : "r-fm-seed-nodes"),
              po::value<size_t>((initial_partitioning ? &context.initial_partitioning.refinement.fm.num_seed_nodes :
                                 &context.refinement.fm.num_seed_nodes))->value_name("<size_t>")->default_value(25),
@@ -634,7 +710,12 @@ namespace mt_kahypar {
             ("s-shuffle-block-size",
              po::value<size_t>(&context.shared_memory.shuffle_block_size)->value_name("<size_t>"),
              "If we perform a localized random shuffle in parallel, we perform a parallel for over blocks of size"
-             "'shuffle_block_size' and shuffle them sequential.");
+             "'shuffle_block_size' and shuffle them sequential.")
+            ("s-memory-budget",
+             po::value<size_t>(&context.shared_memory.memory_budget)->value_name("<size_t>"),
+             "Memory budget in MB (0 = unlimited). If the estimated memory consumption exceeds the budget,\n"
+             "algorithms that require less memory are used (e.g., low-memory contraction in community detection,\n"
+             "fewer parallel flow searches, smaller initial partitioning pools, gain recomputation instead of the gain cache).");
 
     return shared_memory_options;
   }
@@ -775,6 +856,8 @@ namespace mt_kahypar {
             + ".KaHyPar";
     context.partition.graph_community_filename =
             context.partition.graph_filename + ".community";
+    context.partition.graph_community_cache_filename =
+            context.partition.graph_filename + ".community.cache";
 
     if (context.partition.deterministic) {
       context.preprocessing.stable_construction_of_incident_edges = true;
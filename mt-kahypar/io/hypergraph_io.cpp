@@ -32,6 +32,8 @@
 #include <iostream>
 #include <thread>
 #include <memory>
+#include <stdexcept>
+#include <string>
 #include <vector>
 #include <fcntl.h>
 #include <sys/stat.h>
@@ -46,7 +48,7 @@ namespace mt_kahypar::io {
   int open_file(const std::string& filename) {
     int fd = open(filename.c_str(), O_RDONLY);
     if ( fd == -1 ) {
-      ERROR("Could not open:" << filename);
+      throw std::invalid_argument("Could not open: " + filename);
     }
     return fd;
   }
@@ -54,7 +56,7 @@ namespace mt_kahypar::io {
   size_t file_size(int fd) {
     struct stat file_info;
     if ( fstat(fd, &file_info) == -1 ) {
-      ERROR("Error while getting file stats");
+      throw std::runtime_error("Error while getting file stats");
     }
     return static_cast<size_t>(file_info.st_size);
   }
@@ -63,7 +65,7 @@ namespace mt_kahypar::io {
     char* mapped_file = (char*) mmap(0, length, PROT_READ, MAP_SHARED, fd, 0);
     if ( mapped_file == MAP_FAILED ) {
       close(fd);
-      ERROR("Error while mapping file to memory");
+      throw std::runtime_error("Error while mapping file to memory");
     }
     return mapped_file;
   }
@@ -71,7 +73,7 @@ namespace mt_kahypar::io {
   void munmap_file(char* mapped_file, int fd, const size_t length) {
     if ( munmap(mapped_file, length) == -1 ) {
       close(fd);
-      ERROR("Error while unmapping file from memory");
+      throw std::runtime_error("Error while unmapping file from memory");
     }
   }
 
@@ -131,7 +133,12 @@ namespace mt_kahypar::io {
     num_hyperedges = read_number(mapped_file, pos, length);
     num_hypernodes = read_number(mapped_file, pos, length);
     if ( mapped_file[pos] != '\n' ) {
-      type = static_cast<mt_kahypar::Type>(read_number(mapped_file, pos, length));
+      const int64_t format_num = read_number(mapped_file, pos, length);
+      if ( format_num != 0 && format_num != 1 && format_num != 10 && format_num != 11 ) {
+        throw std::invalid_argument("Invalid format type " + std::to_string(format_num) +
+                                    " in hypergraph file header");
+      }
+      type = static_cast<mt_kahypar::Type>(format_num);
     }
     do_line_ending(mapped_file, pos);
   }
@@ -177,6 +184,7 @@ namespace mt_kahypar::io {
                                      size_t& pos,
                                      const size_t length,
                                      const HyperedgeID num_hyperedges,
+                                     const HypernodeID num_hypernodes,
                                      const mt_kahypar::Type type,
                                      HyperedgeVector& hyperedges,
                                      parallel::scalable_vector<HyperedgeWeight>& hyperedges_weight,
@@ -198,10 +206,11 @@ namespace mt_kahypar::io {
               (num_hyperedges / ( 2 * std::thread::hardware_concurrency())), ID(1));
       while ( current_num_hyperedges < num_hyperedges ) {
         // Skip Comments
-        ASSERT(pos < length);
-        while ( mapped_file[pos] == '%' ) {
+        while ( pos < length && mapped_file[pos] == '%' ) {
           goto_next_line(mapped_file, pos, length);
-          ASSERT(pos < length);
+        }
+        if ( pos >= length ) {
+          throw std::invalid_argument("Hypergraph file contains fewer hyperedges than specified in its header");
         }
 
         ASSERT(mapped_file[pos - 1] == '\n');
@@ -265,13 +274,17 @@ namespace mt_kahypar::io {
 
           Hyperedge& hyperedge = hyperedges[current_id];
           // Note, a hyperedge line must contain at least one pin
-          HypernodeID pin = read_number(mapped_file, current_pos, current_end);
-          ASSERT(pin > 0, V(current_id));
-          hyperedge.push_back(pin - 1);
-          while ( mapped_file[current_pos] != '\n' ) {
-            pin = read_number(mapped_file, current_pos, current_end);
-            ASSERT(pin > 0, V(current_id));
+          auto read_pin = [&] {
+            const int64_t pin = read_number(mapped_file, current_pos, current_end);
+            if ( pin <= 0 || pin > static_cast<int64_t>(num_hypernodes) ) {
+              throw std::invalid_argument("Pin " + std::to_string(pin) +
+                                          " of a hyperedge is not a valid hypernode ID");
+            }
             hyperedge.push_back(pin - 1);
+          };
+          read_pin();
+          while ( current_pos < current_end && mapped_file[current_pos] != '\n' ) {
+            read_pin();
           }
           do_line_ending(mapped_file, current_pos);
 
@@ -314,7 +327,10 @@ namespace mt_kahypar::io {
     if ( has_hypernode_weights ) {
       hypernodes_weight.resize(num_hypernodes);
       for ( HypernodeID hn = 0; hn < num_hypernodes; ++hn ) {
-        ASSERT(pos > 0 && pos < length);
+        if ( pos >= length ) {
+          throw std::invalid_argument("Hypergraph file contains fewer hypernode weights than hypernodes");
+        }
+        ASSERT(pos > 0);
         ASSERT(mapped_file[pos - 1] == '\n');
         hypernodes_weight[hn] = read_number(mapped_file, pos, length);
         do_line_ending(mapped_file, pos);
@@ -337,26 +353,33 @@ namespace mt_kahypar::io {
     char* mapped_file = mmap_file(fd, length);
     size_t pos = 0;
 
-    // Read Hypergraph Header
-    mt_kahypar::Type type = mt_kahypar::Type::Unweighted;
-    readHGRHeader(mapped_file, pos, length, num_hyperedges, num_hypernodes, type);
-
-    // Read Hyperedges
-    HyperedgeReadResult res =
-            readHyperedges(mapped_file, pos, length, num_hyperedges,
-              type, hyperedges, hyperedges_weight, remove_single_pin_hes);
-    num_hyperedges -= res.num_removed_single_pin_hyperedges;
-    num_removed_single_pin_hyperedges = res.num_removed_single_pin_hyperedges;
+    try {
+      // Read Hypergraph Header
+      mt_kahypar::Type type = mt_kahypar::Type::Unweighted;
+      readHGRHeader(mapped_file, pos, length, num_hyperedges, num_hypernodes, type);
+
+      // Read Hyperedges
+      HyperedgeReadResult res =
+              readHyperedges(mapped_file, pos, length, num_hyperedges, num_hypernodes,
+                type, hyperedges, hyperedges_weight, remove_single_pin_hes);
+      num_hyperedges -= res.num_removed_single_pin_hyperedges;
+      num_removed_single_pin_hyperedges = res.num_removed_single_pin_hyperedges;
+
+      if ( res.num_hes_with_duplicated_pins > 0 ) {
+        WARNING("Removed" << res.num_duplicated_pins << "duplicated pins in"
+          << res.num_hes_with_duplicated_pins << "hyperedges!");
+      }
 
-    if ( res.num_hes_with_duplicated_pins > 0 ) {
-      WARNING("Removed" << res.num_duplicated_pins << "duplicated pins in"
-        << res.num_hes_with_duplicated_pins << "hyperedges!");
+      // Read Hypernode Weights
+      readHypernodeWeights(mapped_file, pos, length, num_hypernodes, type, hypernodes_weight);
+      ASSERT(pos == length);
+    } catch ( ... ) {
+      // Malformed input must not leak the mapping and file descriptor
+      munmap(mapped_file, length);
+      close(fd);
+      throw;
     }
 
-    // Read Hypernode Weights
-    readHypernodeWeights(mapped_file, pos, length, num_hypernodes, type, hypernodes_weight);
-    ASSERT(pos == length);
-
     munmap_file(mapped_file, fd, length);
     close(fd);
   }
@@ -433,11 +456,14 @@ namespace mt_kahypar::io {
 
     if ( mapped_file[pos] != '\n' ) {
       // read the (up to) three 0/1 format digits
-      uint32_t format_num = read_number(mapped_file, pos, length);
-      ASSERT(format_num < 100, "Vertex sizes in input file are not supported.");
-      ASSERT(format_num / 10 == 0 || format_num / 10 == 1);
+      const int64_t format_num = read_number(mapped_file, pos, length);
+      if ( format_num >= 100 ) {
+        throw std::invalid_argument("Vertex sizes in input file are not supported.");
+      } else if ( format_num / 10 > 1 || format_num % 10 > 1 ) {
+        throw std::invalid_argument("Invalid format " + std::to_string(format_num) +
+                                    " in metis file header");
+      }
       has_vertex_weights = (format_num / 10 == 1);
-      ASSERT(format_num % 10 == 0 || format_num % 10 == 1);
       has_edge_weights = (format_num % 10 == 1);
     }
     do_line_ending(mapped_file, pos);
@@ -475,10 +501,11 @@ namespace mt_kahypar::io {
               (num_vertices / ( 2 * std::thread::hardware_concurrency())), ID(1));
       while ( current_range_vertex_id + current_range_num_vertices < num_vertices ) {
         // Skip Comments
-        ASSERT(pos < length);
-        while ( mapped_file[pos] == '%' ) {
+        while ( pos < length && mapped_file[pos] == '%' ) {
           goto_next_line(mapped_file, pos, length);
-          ASSERT(pos < length);
+        }
+        if ( pos >= length ) {
+          throw std::invalid_argument("Metis file contains fewer vertices than specified in its header");
         }
 
         ASSERT(mapped_file[pos - 1] == '\n');
@@ -491,11 +518,15 @@ namespace mt_kahypar::io {
           read_number(mapped_file, pos, length);
         }
         HyperedgeID vertex_degree = 0;
-        while (mapped_file[pos] != '\n' && pos < length) {
+        while (pos < length && mapped_file[pos] != '\n') {
           const HypernodeID source = current_range_vertex_id + current_range_num_vertices;
-          const HypernodeID target = read_number(mapped_file, pos, length);
+          const int64_t target = read_number(mapped_file, pos, length);
+          if ( target <= 0 || target > static_cast<int64_t>(num_vertices) ) {
+            throw std::invalid_argument("Neighbor " + std::to_string(target) +
+                                        " of a vertex is not a valid vertex ID");
+          }
           ASSERT(source != target);
-          if ( source < target ) {
+          if ( source < static_cast<HypernodeID>(target) ) {
             ++vertex_degree;
           }
           if ( has_edge_weights ) {
@@ -524,7 +555,10 @@ namespace mt_kahypar::io {
         current_range_edge_id += current_range_num_edges;
       }
       ASSERT(current_range_vertex_id == num_vertices);
-      ASSERT(current_range_edge_id == num_edges);
+      if ( current_range_edge_id != num_edges ) {
+        throw std::invalid_argument("Metis file contains " + std::to_string(current_range_edge_id) +
+                                    " edges, but its header specifies " + std::to_string(num_edges));
+      }
     }, [&] {
       edges.resize(num_edges);
     }, [&] {
@@ -609,16 +643,22 @@ namespace mt_kahypar::io {
     char* mapped_file = mmap_file(fd, length);
     size_t pos = 0;
 
-    // Read Metis Header
-    bool has_edge_weights = false;
-    bool has_vertex_weights = false;
-    readMetisHeader(mapped_file, pos, length, num_edges,
-      num_vertices, has_edge_weights, has_vertex_weights);
-
-    // Read Vertices
-    readVertices(mapped_file, pos, length, num_edges, num_vertices,
-      has_edge_weights, has_vertex_weights, edges, edges_weight, vertices_weight);
-    ASSERT(pos == length);
+    try {
+      // Read Metis Header
+      bool has_edge_weights = false;
+      bool has_vertex_weights = false;
+      readMetisHeader(mapped_file, pos, length, num_edges,
+        num_vertices, has_edge_weights, has_vertex_weights);
+
+      // Read Vertices
+      readVertices(mapped_file, pos, length, num_edges, num_vertices,
+        has_edge_weights, has_vertex_weights, edges, edges_weight, vertices_weight);
+      ASSERT(pos == length);
+    } catch ( ... ) {
+      munmap(mapped_file, length);
+      close(fd);
+      throw;
+    }
 
     munmap_file(mapped_file, fd, length);
     close(fd);
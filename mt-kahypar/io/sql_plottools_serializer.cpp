@@ -59,6 +59,7 @@ std::string serialize(const PartitionedHypergraph& hypergraph,
     oss << " large_hyperedge_size_threshold_factor=" << context.partition.large_hyperedge_size_threshold_factor
         << " smallest_large_he_size_threshold=" << context.partition.smallest_large_he_size_threshold
         << " large_hyperedge_size_threshold=" << context.partition.large_hyperedge_size_threshold
+        << " approximate_large_hyperedges=" << std::boolalpha << context.partition.approximate_large_hyperedges
         << " ignore_hyperedge_size_threshold=" << context.partition.ignore_hyperedge_size_threshold
         << " time_limit=" << context.partition.time_limit
         << " use_individual_part_weights=" << context.partition.use_individual_part_weights
@@ -67,12 +68,15 @@ std::string serialize(const PartitionedHypergraph& hypergraph,
         << " total_graph_weight=" << hypergraph.totalWeight();
     oss << " use_community_detection=" << std::boolalpha << context.preprocessing.use_community_detection
         << " disable_community_detection_for_mesh_graphs=" << std::boolalpha << context.preprocessing.disable_community_detection_for_mesh_graphs
+        << " contract_twin_vertices=" << std::boolalpha << context.preprocessing.contract_twin_vertices
+        << " merge_identical_nets=" << std::boolalpha << context.preprocessing.merge_identical_nets
         << " community_edge_weight_function=" << context.preprocessing.community_detection.edge_weight_function
         << " community_max_pass_iterations=" << context.preprocessing.community_detection.max_pass_iterations
         << " community_min_vertex_move_fraction=" << context.preprocessing.community_detection.min_vertex_move_fraction
         << " community_vertex_degree_sampling_threshold=" << context.preprocessing.community_detection.vertex_degree_sampling_threshold
         << " community_num_sub_rounds_deterministic=" << context.preprocessing.community_detection.num_sub_rounds_deterministic
-        << " community_low_memory_contraction=" << context.preprocessing.community_detection.low_memory_contraction;
+        << " community_low_memory_contraction=" << context.preprocessing.community_detection.low_memory_contraction
+        << " community_implicit_star_expansion=" << context.preprocessing.community_detection.implicit_star_expansion;
     oss << " coarsening_algorithm=" << context.coarsening.algorithm
         << " coarsening_contraction_limit_multiplier=" << context.coarsening.contraction_limit_multiplier
         << " coarsening_use_adaptive_edge_size=" << std::boolalpha << context.coarsening.use_adaptive_edge_size
@@ -84,7 +88,12 @@ std::string serialize(const PartitionedHypergraph& hypergraph,
         << " coarsening_maximum_shrink_factor=" << context.coarsening.maximum_shrink_factor
         << " coarsening_max_allowed_node_weight=" << context.coarsening.max_allowed_node_weight
         << " coarsening_vertex_degree_sampling_threshold=" << context.coarsening.vertex_degree_sampling_threshold
+        << " coarsening_large_net_sampling_threshold=" << context.coarsening.large_net_sampling_threshold
+        << " coarsening_large_net_sample_size=" << context.coarsening.large_net_sample_size
         << " coarsening_num_sub_rounds_deterministic=" << context.coarsening.num_sub_rounds_deterministic
+        << " coarsening_counting_sort_contraction=" << std::boolalpha << context.coarsening.counting_sort_contraction
+        << " coarsening_use_two_hop_clustering=" << std::boolalpha << context.coarsening.use_two_hop_clustering
+        << " coarsening_two_hop_shrink_factor_threshold=" << context.coarsening.two_hop_shrink_factor_threshold
         << " coarsening_contraction_limit=" << context.coarsening.contraction_limit
         << " rating_function=" << context.coarsening.rating.rating_function
         << " rating_heavy_node_penalty_policy=" << context.coarsening.rating.heavy_node_penalty_policy
@@ -117,7 +126,8 @@ std::string serialize(const PartitionedHypergraph& hypergraph,
         << " lp_hyperedge_size_activation_threshold=" << context.refinement.label_propagation.hyperedge_size_activation_threshold
         << " sync_lp_num_sub_rounds_sync_lp=" << context.refinement.deterministic_refinement.num_sub_rounds_sync_lp
         << " sync_lp_use_active_node_set=" << context.refinement.deterministic_refinement.use_active_node_set
-        << " sync_lp_recalculate_gains_on_second_apply=" << context.refinement.deterministic_refinement.recalculate_gains_on_second_apply;
+        << " sync_lp_recalculate_gains_on_second_apply=" << context.refinement.deterministic_refinement.recalculate_gains_on_second_apply
+        << " deterministic_fm_num_sub_rounds=" << context.refinement.deterministic_refinement.num_sub_rounds_fm;
     oss << " fm_algorithm=" << context.refinement.fm.algorithm
         << " fm_multitry_rounds=" << context.refinement.fm.multitry_rounds
         << " fm_perform_moves_global=" << std::boolalpha << context.refinement.fm.perform_moves_global
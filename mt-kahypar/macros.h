@@ -48,6 +48,15 @@
 #define MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
 #endif
 
+// Functions that use instruction set extensions which are selected at runtime
+// (e.g., AVX2 or AVX-512 kernels) must be compiled for the corresponding target
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+#define MT_KAHYPAR_HAS_X86_SIMD_DISPATCH
+#define MT_KAHYPAR_ATTRIBUTE_TARGET(ISA) __attribute__ ((target(ISA)))
+#else
+#define MT_KAHYPAR_ATTRIBUTE_TARGET(ISA)
+#endif
+
 #define HEAVY_ASSERT0(cond) \
   !(enable_heavy_assert) ? (void)0 : [&]() { ASSERT(cond); } ()
 #define HEAVY_ASSERT1(cond, msg) \
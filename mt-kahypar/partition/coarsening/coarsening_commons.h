@@ -143,13 +143,35 @@ public:
     is_finalized = true;
   }
 
+  // ! Prepares the finalized multilevel hierarchy for a further partitioning run
+  // ! whose contraction limit is at least as large as the one used for coarsening
+  // ! (e.g., a larger number of blocks). All levels beyond the first level at which
+  // ! coarsening would have stopped for the given context are discarded. Then, a new
+  // ! partitioned hypergraph with the number of blocks of the given context is
+  // ! constructed for the coarsest remaining level. Since levels are only removed,
+  // ! contexts must be processed in increasing order of their contraction limits.
+  void reuseHierarchy(const Context& context) {
+    ASSERT(is_finalized && !nlevel);
+    while ( hierarchy.size() > 1 &&
+            hierarchy[hierarchy.size() - 2].contractedHypergraph().initialNumNodes() <=
+            context.coarsening.contraction_limit ) {
+      hierarchy.back().freeInternalData();
+      hierarchy.pop_back();
+    }
+    *partitioned_hg = PartitionedHypergraph(context.partition.k, _hg, parallel_tag_t());
+    if (!hierarchy.empty()) {
+      partitioned_hg->setHypergraph(hierarchy.back().contractedHypergraph());
+    }
+  }
+
   void performMultilevelContraction(
           parallel::scalable_vector<HypernodeID>&& communities,
           const HighResClockTimepoint& round_start) {
     ASSERT(!is_finalized);
     Hypergraph& current_hg = hierarchy.empty() ? _hg : hierarchy.back().contractedHypergraph();
     ASSERT(current_hg.initialNumNodes() == communities.size());
-    Hypergraph contracted_hg = current_hg.contract(communities);
+    Hypergraph contracted_hg = current_hg.contract(
+      communities, _context.coarsening.counting_sort_contraction);
     const HighResClockTimepoint round_end = std::chrono::high_resolution_clock::now();
     const double elapsed_time = std::chrono::duration<double>(round_end - round_start).count();
     hierarchy.emplace_back(std::move(contracted_hg), std::move(communities), elapsed_time);
@@ -28,11 +28,13 @@
 #pragma once
 
 #include <string>
+#include <tuple>
 
 #include "tbb/concurrent_queue.h"
 #include "tbb/task_group.h"
 #include "tbb/parallel_for.h"
 #include "tbb/parallel_reduce.h"
+#include "tbb/parallel_sort.h"
 
 #include "kahypar/meta/mandatory.h"
 
@@ -249,6 +251,18 @@ class MultilevelCoarsener : public ICoarsener,
       current_num_nodes = num_hns_before_pass - contracted_nodes.combine(std::plus<>());
       DBG << V(current_num_nodes);
 
+      if ( _context.coarsening.use_two_hop_clustering &&
+           current_num_nodes > hierarchy_contraction_limit &&
+           static_cast<double>(num_hns_before_pass) / static_cast<double>(current_num_nodes) <
+           _context.coarsening.two_hop_shrink_factor_threshold ) {
+        // Many vertices remained unmatched (e.g., leaves of stars), we therefore
+        // cluster unmatched vertices that share a common favorite neighbor
+        _timer.start_timer("two_hop_clustering", "Two-Hop Clustering");
+        current_num_nodes -= twoHopClustering(current_hg, cluster_ids);
+        _timer.stop_timer("two_hop_clustering");
+        DBG << "Two-hop clustering:" << V(current_num_nodes);
+      }
+
       HEAVY_COARSENING_ASSERT([&] {
         parallel::scalable_vector<HypernodeWeight> expected_weights(current_hg.initialNumNodes());
         // Verify that clustering is correct
@@ -441,6 +455,92 @@ class MultilevelCoarsener : public ICoarsener,
     return success;
   }
 
+  /*!
+   * Clusters vertices that remained unmatched in the current pass (singleton clusters).
+   * The favorite net of an unmatched vertex u is its incident net with the highest
+   * weight / (size - 1) (nets larger than ignore_hyperedge_size_threshold are ignored)
+   * and its favorite neighbor is the pin of that net with the highest degree.
+   * Unmatched vertices of the same community with the same favorite neighbor cluster
+   * are grouped (as the rater, we do not contract vertices of different communities) and,
+   * within a group, consecutive vertices in order of their degree are paired such that
+   * vertices with similar degrees are contracted (degree-aware). Since each unmatched
+   * vertex belongs to exactly one group, the groups can be processed in parallel.
+   * Returns the number of contracted vertices.
+   */
+  HypernodeID twoHopClustering(const Hypergraph& hypergraph,
+                               parallel::scalable_vector<HypernodeID>& cluster_ids) {
+    // (community, favorite neighbor cluster, degree, vertex)
+    using TwoHopKey = std::tuple<PartitionID, HypernodeID, HyperedgeID, HypernodeID>;
+    tbb::enumerable_thread_specific<parallel::scalable_vector<TwoHopKey>> local_keys;
+    hypergraph.doParallelForAllNodes([&](const HypernodeID hn) {
+      if ( cluster_ids[hn] != hn || _cluster_weight[hn] != hypergraph.nodeWeight(hn) ||
+           hypergraph.nodeWeight(hn) >= _max_allowed_node_weight ) {
+        return;
+      }
+      HyperedgeID favorite_net = kInvalidHyperedge;
+      double best_score = 0.0;
+      for ( const HyperedgeID& he : hypergraph.incidentEdges(hn) ) {
+        const HypernodeID edge_size = hypergraph.edgeSize(he);
+        if ( edge_size > 1 && edge_size < _context.partition.ignore_hyperedge_size_threshold ) {
+          const double score = static_cast<double>(hypergraph.edgeWeight(he)) / (edge_size - 1);
+          if ( score > best_score || ( score == best_score && he < favorite_net ) ) {
+            favorite_net = he;
+            best_score = score;
+          }
+        }
+      }
+      if ( favorite_net == kInvalidHyperedge ) {
+        return;
+      }
+      HypernodeID favorite_neighbor = kInvalidHypernode;
+      for ( const HypernodeID& pin : hypergraph.pins(favorite_net) ) {
+        if ( pin != hn && ( favorite_neighbor == kInvalidHypernode ||
+             hypergraph.nodeDegree(pin) > hypergraph.nodeDegree(favorite_neighbor) ||
+             ( hypergraph.nodeDegree(pin) == hypergraph.nodeDegree(favorite_neighbor) &&
+               pin < favorite_neighbor ) ) ) {
+          favorite_neighbor = pin;
+        }
+      }
+      ASSERT(favorite_neighbor != kInvalidHypernode);
+      local_keys.local().emplace_back(hypergraph.communityID(hn),
+        cluster_ids[favorite_neighbor], hypergraph.nodeDegree(hn), hn);
+    });
+    parallel::scalable_vector<TwoHopKey> keys;
+    for ( const auto& local : local_keys ) {
+      keys.insert(keys.end(), local.begin(), local.end());
+    }
+    tbb::parallel_sort(keys.begin(), keys.end());
+
+    parallel::scalable_vector<size_t> group_starts;
+    for ( size_t i = 0; i < keys.size(); ++i ) {
+      if ( i == 0 || std::get<0>(keys[i]) != std::get<0>(keys[i - 1]) ||
+           std::get<1>(keys[i]) != std::get<1>(keys[i - 1]) ) {
+        group_starts.push_back(i);
+      }
+    }
+    group_starts.push_back(keys.size());
+
+    tbb::enumerable_thread_specific<HypernodeID> contracted_nodes(0);
+    tbb::parallel_for(0UL, group_starts.size() - 1, [&](const size_t group) {
+      const size_t end = group_starts[group + 1];
+      for ( size_t i = group_starts[group]; i + 1 < end; ) {
+        const HypernodeID u = std::get<3>(keys[i]);
+        const HypernodeID v = std::get<3>(keys[i + 1]);
+        if ( hypergraph.nodeWeight(u) + hypergraph.nodeWeight(v) <= _max_allowed_node_weight ) {
+          cluster_ids[v] = u;
+          _cluster_weight[u] += hypergraph.nodeWeight(v);
+          _matching_state[u] = STATE(MatchingState::MATCHED);
+          _matching_state[v] = STATE(MatchingState::MATCHED);
+          ++contracted_nodes.local();
+          i += 2;
+        } else {
+          ++i;
+        }
+      }
+    });
+    return contracted_nodes.combine(std::plus<HypernodeID>());
+  }
+
   Hypergraph& coarsestHypergraphImpl() override {
     return Base::currentHypergraph();
   }
@@ -34,6 +34,8 @@
 
 #include "tbb/enumerable_thread_specific.h"
 
+#include "gtest/gtest_prod.h"
+
 #include "kahypar/datastructure/fast_reset_flag_array.h"
 #include "kahypar/meta/mandatory.h"
 
@@ -41,6 +43,8 @@
 
 #include "mt-kahypar/definitions.h"
 #include "mt-kahypar/partition/context.h"
+#include "mt-kahypar/partition/coarsening/rating_accumulation.h"
+#include "mt-kahypar/utils/hash.h"
 
 namespace mt_kahypar {
 template <typename ScorePolicy = Mandatory,
@@ -53,6 +57,7 @@ class MultilevelVertexPairRater {
   using ThreadLocalVertexDegreeBoundedRatingMap = tbb::enumerable_thread_specific<CacheEfficientRatingMap>;
   using ThreadLocalLargeTmpRatingMap = tbb::enumerable_thread_specific<LargeTmpRatingMap>;
   using ThreadLocalFastResetFlagArray = tbb::enumerable_thread_specific<kahypar::ds::FastResetFlagArray<> >;
+  using ThreadLocalRepresentatives = tbb::enumerable_thread_specific<parallel::scalable_vector<HypernodeID>>;
 
  private:
   static constexpr bool debug = false;
@@ -96,6 +101,8 @@ class MultilevelVertexPairRater {
     _context(context),
     _current_num_nodes(hypergraph.initialNumNodes()),
     _vertex_degree_sampling_threshold(context.coarsening.vertex_degree_sampling_threshold),
+    _large_net_sampling_threshold(std::max(
+      context.coarsening.large_net_sampling_threshold, context.coarsening.large_net_sample_size)),
     _local_cache_efficient_rating_map(0.0),
     _local_vertex_degree_bounded_rating_map(3UL * _vertex_degree_sampling_threshold, 0.0),
     _local_large_rating_map([&] {
@@ -105,6 +112,8 @@ class MultilevelVertexPairRater {
     _bloom_filter_mask(align_to_next_power_of_two(
       std::min(ID(10) * hypergraph.maxEdgeSize(), _current_num_nodes)) - 1),
     _local_bloom_filter(_bloom_filter_mask + 1),
+    _use_vectorized_gather(rating_accumulation::canUseVectorizedGather(hypergraph.initialNumNodes())),
+    _local_sampled_representatives(),
     _already_matched(hypergraph.initialNumNodes()) { }
 
   MultilevelVertexPairRater(const MultilevelVertexPairRater&) = delete;
@@ -150,7 +159,30 @@ class MultilevelVertexPairRater {
     _current_num_nodes = current_num_nodes;
   }
 
+  // ! Edge size used to score a sampled hyperedge. If adaptive edge sizes are used,
+  // ! the number of distinct cluster IDs is extrapolated from the sample.
+  inline HypernodeID sampledEdgeSize(const HypernodeID edge_size,
+                                     const size_t num_sampled_representatives) const {
+    if ( _context.coarsening.use_adaptive_edge_size ) {
+      const double fraction = static_cast<double>(num_sampled_representatives) /
+        static_cast<double>(_context.coarsening.large_net_sample_size);
+      return std::max(std::min(static_cast<HypernodeID>(fraction * edge_size), edge_size), ID(2));
+    }
+    return edge_size;
+  }
+
  private:
+  FRIEND_TEST(ALargeNetSampler, SamplesDistinctPinsOfALargeHyperedge);
+  FRIEND_TEST(ALargeNetSampler, SamplesOnlyClusterIDsOfPins);
+  FRIEND_TEST(ALargeNetSampler, SamplesTheSamePinsForAllPinsOfAHyperedge);
+
+  // ! Only for testing
+  const parallel::scalable_vector<HypernodeID>& sampleRepresentatives(const Hypergraph& hypergraph,
+                                                                     const HyperedgeID he,
+                                                                     const parallel::scalable_vector<HypernodeID>& cluster_ids) {
+    return sampleRepresentatives(hypergraph, he, _local_bloom_filter.local(), cluster_ids);
+  }
+
   template<typename RatingMap>
   VertexPairRating rate(const Hypergraph& hypergraph,
                         const HypernodeID u,
@@ -214,20 +246,28 @@ class MultilevelVertexPairRater {
     for ( const HyperedgeID& he : hypergraph.incidentEdges(u) ) {
       HypernodeID edge_size = hypergraph.edgeSize(he);
       ASSERT(edge_size > 1, V(he));
-      if ( edge_size < _context.partition.ignore_hyperedge_size_threshold ) {
+      if ( edge_size > _large_net_sampling_threshold &&
+           edge_size < _context.partition.ignore_hyperedge_size_threshold ) {
+        const parallel::scalable_vector<HypernodeID>& representatives =
+          sampleRepresentatives(hypergraph, he, bloom_filter, cluster_ids);
+        const RatingType score = ScorePolicy::score(hypergraph.edgeWeight(he),
+          sampledEdgeSize(edge_size, representatives.size()));
+        for ( const HypernodeID& representative : representatives ) {
+          tmp_ratings[representative] += score;
+        }
+      } else if ( edge_size < _context.partition.ignore_hyperedge_size_threshold ) {
         edge_size = _context.coarsening.use_adaptive_edge_size ?
           std::max(adaptiveEdgeSize(hypergraph, he, bloom_filter, cluster_ids), ID(2)) : edge_size;
         const RatingType score = ScorePolicy::score(
           hypergraph.edgeWeight(he), edge_size);
-        for ( const HypernodeID& v : hypergraph.pins(he) ) {
-          const HypernodeID representative = cluster_ids[v];
+        forEachPinRepresentative(hypergraph, he, cluster_ids, [&](const HypernodeID representative) {
           ASSERT(representative < hypergraph.initialNumNodes());
           const HypernodeID bloom_filter_rep = representative & _bloom_filter_mask;
           if ( !bloom_filter[bloom_filter_rep] ) {
             tmp_ratings[representative] += score;
             bloom_filter.set(bloom_filter_rep, true);
           }
-        }
+        });
         bloom_filter.reset();
       }
     }
@@ -242,7 +282,20 @@ class MultilevelVertexPairRater {
     size_t num_tmp_rating_map_accesses = 0;
     for ( const HyperedgeID& he : hypergraph.incidentEdges(u) ) {
       HypernodeID edge_size = hypergraph.edgeSize(he);
-      if ( edge_size < _context.partition.ignore_hyperedge_size_threshold ) {
+      if ( edge_size > _large_net_sampling_threshold &&
+           edge_size < _context.partition.ignore_hyperedge_size_threshold ) {
+        const parallel::scalable_vector<HypernodeID>& representatives =
+          sampleRepresentatives(hypergraph, he, bloom_filter, cluster_ids);
+        if ( num_tmp_rating_map_accesses + representatives.size() > _vertex_degree_sampling_threshold  ) {
+          break;
+        }
+        const RatingType score = ScorePolicy::score(hypergraph.edgeWeight(he),
+          sampledEdgeSize(edge_size, representatives.size()));
+        for ( const HypernodeID& representative : representatives ) {
+          tmp_ratings[representative] += score;
+        }
+        num_tmp_rating_map_accesses += representatives.size();
+      } else if ( edge_size < _context.partition.ignore_hyperedge_size_threshold ) {
         edge_size = _context.coarsening.use_adaptive_edge_size ?
           std::max(adaptiveEdgeSize(hypergraph, he, bloom_filter, cluster_ids), ID(2)) : edge_size;
         // Break if number of accesses to the tmp rating map would exceed
@@ -252,8 +305,7 @@ class MultilevelVertexPairRater {
         }
         const RatingType score = ScorePolicy::score(
           hypergraph.edgeWeight(he), edge_size);
-        for ( const HypernodeID& v : hypergraph.pins(he) ) {
-          const HypernodeID representative = cluster_ids[v];
+        forEachPinRepresentative(hypergraph, he, cluster_ids, [&](const HypernodeID representative) {
           ASSERT(representative < hypergraph.initialNumNodes());
           const HypernodeID bloom_filter_rep = representative & _bloom_filter_mask;
           if ( !bloom_filter[bloom_filter_rep] ) {
@@ -261,7 +313,7 @@ class MultilevelVertexPairRater {
             bloom_filter.set(bloom_filter_rep, true);
             ++num_tmp_rating_map_accesses;
           }
-        }
+        });
         bloom_filter.reset();
       }
     }
@@ -272,19 +324,88 @@ class MultilevelVertexPairRater {
                                       kahypar::ds::FastResetFlagArray<>& bloom_filter,
                                       const parallel::scalable_vector<HypernodeID>& cluster_ids) {
     HypernodeID edge_size = 0;
-    for ( const HypernodeID& v : hypergraph.pins(he) ) {
-      const HypernodeID representative = cluster_ids[v];
+    forEachPinRepresentative(hypergraph, he, cluster_ids, [&](const HypernodeID representative) {
       ASSERT(representative < hypergraph.initialNumNodes());
       const HypernodeID bloom_filter_rep = representative & _bloom_filter_mask;
       if ( !bloom_filter[bloom_filter_rep] ) {
         ++edge_size;
         bloom_filter.set(bloom_filter_rep, true);
       }
-    }
+    });
     bloom_filter.reset();
     return edge_size;
   }
 
+  // ! Collects the distinct cluster IDs of a random sample of the pins of a large hyperedge.
+  // ! The sample only depends on the seed, the hyperedge and the current number of nodes.
+  // ! Thus, all pins of the hyperedge see the same sample and the result is independent of
+  // ! the number of threads.
+  template<typename HypergraphT>
+  const parallel::scalable_vector<HypernodeID>& sampleRepresentatives(const HypergraphT& hypergraph,
+                                                                     const HyperedgeID he,
+                                                                     kahypar::ds::FastResetFlagArray<>& bloom_filter,
+                                                                     const parallel::scalable_vector<HypernodeID>& cluster_ids) {
+    parallel::scalable_vector<HypernodeID>& representatives = _local_sampled_representatives.local();
+    representatives.clear();
+    auto add_representative = [&](const HypernodeID representative) {
+      ASSERT(representative < hypergraph.initialNumNodes());
+      const HypernodeID bloom_filter_rep = representative & _bloom_filter_mask;
+      if ( !bloom_filter[bloom_filter_rep] ) {
+        representatives.push_back(representative);
+        bloom_filter.set(bloom_filter_rep, true);
+      }
+    };
+    if constexpr ( !HypergraphT::is_graph ) {
+      auto pins = hypergraph.pins(he);
+      const HypernodeID* first = &*pins.begin();
+      const uint32_t edge_size = hypergraph.edgeSize(he);
+      const uint32_t net_seed = hashing::integer::combine32(
+        hashing::integer::hash32(static_cast<uint32_t>(_context.partition.seed)),
+        hashing::integer::combine32(hashing::integer::hash32(static_cast<uint32_t>(he)),
+          hashing::integer::hash32(static_cast<uint32_t>(_current_num_nodes))));
+      for ( uint32_t i = 0; i < _context.coarsening.large_net_sample_size; ++i ) {
+        const uint32_t pos = hashing::integer::combine32(net_seed, hashing::integer::hash32(i)) % edge_size;
+        add_representative(cluster_ids[first[pos]]);
+      }
+    } else {
+      // Graph edges are never sampled
+      forEachPinRepresentative(hypergraph, he, cluster_ids, add_representative);
+    }
+    bloom_filter.reset();
+    return representatives;
+  }
+
+  // ! Calls f(cluster_ids[v]) for each pin v of hyperedge he (in the order of the pins).
+  // ! For hypergraphs, the cluster IDs of the pins are gathered in batches (with SIMD
+  // ! instructions, if supported) before f is applied to them.
+  template<typename HypergraphT, typename F>
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE void forEachPinRepresentative(const HypergraphT& hypergraph,
+                                                                   const HyperedgeID he,
+                                                                   const parallel::scalable_vector<HypernodeID>& cluster_ids,
+                                                                   const F& f) {
+    if constexpr ( !HypergraphT::is_graph ) {
+      if ( _use_vectorized_gather ) {
+        auto pins = hypergraph.pins(he);
+        const size_t edge_size = hypergraph.edgeSize(he);
+        if ( edge_size > 0 ) {
+          const HypernodeID* first = &*pins.begin();
+          HypernodeID representatives[rating_accumulation::kBatchSize];
+          for ( size_t i = 0; i < edge_size; i += rating_accumulation::kBatchSize ) {
+            const size_t batch_size = std::min(rating_accumulation::kBatchSize, edge_size - i);
+            rating_accumulation::gather(first + i, batch_size, cluster_ids.data(), representatives);
+            for ( size_t j = 0; j < batch_size; ++j ) {
+              f(representatives[j]);
+            }
+          }
+        }
+        return;
+      }
+    }
+    for ( const HypernodeID& v : hypergraph.pins(he) ) {
+      f(cluster_ids[v]);
+    }
+  }
+
   inline RatingMapType getRatingMapTypeForRatingOfHypernode(const Hypergraph& hypergraph,
                                                             const HypernodeID u) {
     const bool use_vertex_degree_sampling =
@@ -337,6 +458,8 @@ class MultilevelVertexPairRater {
   HypernodeID _current_num_nodes;
   // ! Maximum number of neighbors that are considered for rating
   size_t _vertex_degree_sampling_threshold;
+  // ! Only a sample of the pins of hyperedges larger than this threshold is rated
+  size_t _large_net_sampling_threshold;
 
   // ! Cache efficient rating map (with linear probing) that is used if the
   // ! estimated number of neighbors smaller than 10922 (= 32768 / 3)
@@ -354,6 +477,11 @@ class MultilevelVertexPairRater {
   // ! we use this bloom filter.
   size_t _bloom_filter_mask;
   ThreadLocalFastResetFlagArray _local_bloom_filter;
+  // ! If true, the cluster IDs of the pins of a hyperedge are gathered with SIMD
+  // ! instructions (requires that all node IDs fit into a signed 32-bit integer)
+  bool _use_vectorized_gather;
+  // ! Distinct cluster IDs of the sampled pins of a large hyperedge
+  ThreadLocalRepresentatives _local_sampled_representatives;
 
   // ! Marks all matched vertices
   kahypar::ds::FastResetFlagArray<> _already_matched;
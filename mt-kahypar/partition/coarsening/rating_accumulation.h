@@ -0,0 +1,151 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2021 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <limits>
+
+#include "mt-kahypar/macros.h"
+#include "mt-kahypar/datastructures/hypergraph_common.h"
+
+#ifdef MT_KAHYPAR_HAS_X86_SIMD_DISPATCH
+#include <immintrin.h>
+#endif
+
+namespace mt_kahypar {
+namespace rating_accumulation {
+
+// ! Number of pins whose cluster IDs are gathered at once during rating
+static constexpr size_t kBatchSize = 64;
+
+/*
+ * Writes the cluster ID of each pin to representatives (representatives[i] =
+ * cluster_ids[pins[i]] for i < num_pins). During rating, the cluster IDs of the
+ * pins of a net are accessed in random order, which makes them the dominant
+ * cost for large nets. Gathering them in batches before the rating map is
+ * updated decouples the (independent) memory accesses from the sequential
+ * deduplication and accumulation.
+ */
+MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
+void gatherScalar(const HypernodeID* pins,
+                  const size_t num_pins,
+                  const HypernodeID* cluster_ids,
+                  HypernodeID* representatives) {
+  for ( size_t i = 0; i < num_pins; ++i ) {
+    representatives[i] = cluster_ids[pins[i]];
+  }
+}
+
+#ifdef MT_KAHYPAR_HAS_X86_SIMD_DISPATCH
+namespace impl {
+
+// ! Vector gathers use signed 32-bit indices. Therefore, the kernels are only
+// ! used for 32-bit IDs and if all IDs are smaller than 2^31 (see canUseVectorizedGather).
+MT_KAHYPAR_ATTRIBUTE_TARGET("avx2")
+inline void gatherAVX2(const HypernodeID* pins,
+                       const size_t num_pins,
+                       const HypernodeID* cluster_ids,
+                       HypernodeID* representatives) {
+  const int* base = reinterpret_cast<const int*>(cluster_ids);
+  size_t i = 0;
+  for ( ; i + 8 <= num_pins; i += 8 ) {
+    const __m256i idx = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pins + i));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(representatives + i),
+      _mm256_i32gather_epi32(base, idx, sizeof(HypernodeID)));
+  }
+  gatherScalar(pins + i, num_pins - i, cluster_ids, representatives + i);
+}
+
+MT_KAHYPAR_ATTRIBUTE_TARGET("avx512f")
+inline void gatherAVX512(const HypernodeID* pins,
+                         const size_t num_pins,
+                         const HypernodeID* cluster_ids,
+                         HypernodeID* representatives) {
+  size_t i = 0;
+  for ( ; i + 16 <= num_pins; i += 16 ) {
+    const __m512i idx = _mm512_loadu_si512(pins + i);
+    _mm512_storeu_si512(representatives + i,
+      _mm512_i32gather_epi32(idx, cluster_ids, sizeof(HypernodeID)));
+  }
+  gatherScalar(pins + i, num_pins - i, cluster_ids, representatives + i);
+}
+
+enum class InstructionSet : uint8_t { scalar, avx2, avx512 };
+
+inline InstructionSet detectInstructionSet() {
+  #if defined(__AVX512F__)
+  return InstructionSet::avx512;
+  #elif defined(__AVX2__)
+  return InstructionSet::avx2;
+  #else
+  static const InstructionSet isa = [] {
+    __builtin_cpu_init();
+    if ( __builtin_cpu_supports("avx512f") ) return InstructionSet::avx512;
+    if ( __builtin_cpu_supports("avx2") ) return InstructionSet::avx2;
+    return InstructionSet::scalar;
+  }();
+  return isa;
+  #endif
+}
+
+} // namespace impl
+#endif
+
+// ! Returns true, if the vectorized gather can be used for a hypergraph with num_nodes nodes
+inline bool canUseVectorizedGather(const HypernodeID num_nodes) {
+  return sizeof(HypernodeID) == 4 &&
+    static_cast<uint64_t>(num_nodes) <= static_cast<uint64_t>(std::numeric_limits<int32_t>::max());
+}
+
+/*
+ * Same as gatherScalar(...), but uses AVX-512 or AVX2 gathers if the CPU supports it.
+ * Must only be called if canUseVectorizedGather(...) is true for the hypergraph.
+ */
+MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
+void gather(const HypernodeID* pins,
+            const size_t num_pins,
+            const HypernodeID* cluster_ids,
+            HypernodeID* representatives) {
+  #ifdef MT_KAHYPAR_HAS_X86_SIMD_DISPATCH
+  if constexpr ( sizeof(HypernodeID) == 4 ) {
+    switch ( impl::detectInstructionSet() ) {
+      case impl::InstructionSet::avx512:
+        impl::gatherAVX512(pins, num_pins, cluster_ids, representatives);
+        return;
+      case impl::InstructionSet::avx2:
+        impl::gatherAVX2(pins, num_pins, cluster_ids, representatives);
+        return;
+      case impl::InstructionSet::scalar:
+        break;
+    }
+  }
+  #endif
+  gatherScalar(pins, num_pins, cluster_ids, representatives);
+}
+
+} // namespace rating_accumulation
+} // namespace mt_kahypar
@@ -51,6 +51,7 @@ namespace mt_kahypar {
     str << "  Number of V-Cycles:                 " << params.num_vcycles << std::endl;
     str << "  Ignore HE Size Threshold:           " << params.ignore_hyperedge_size_threshold << std::endl;
     str << "  Large HE Size Threshold:            " << params.large_hyperedge_size_threshold << std::endl;
+    str << "  Approximate Large HEs:              " << std::boolalpha << params.approximate_large_hyperedges << std::endl;
     if ( params.use_individual_part_weights ) {
       str << "  Individual Part Weights:            ";
       for ( const HypernodeWeight& w : params.max_part_weights ) {
@@ -68,6 +69,7 @@ namespace mt_kahypar {
     str << "    Minimum Vertex Move Fraction:        " << params.min_vertex_move_fraction << std::endl;
     str << "    Vertex Degree Sampling Threshold:    " << params.vertex_degree_sampling_threshold << std::endl;
     str << "    Number of subrounds (deterministic): " << params.num_sub_rounds_deterministic << std::endl;
+    str << "    Implicit Star Expansion:             " << std::boolalpha << params.implicit_star_expansion << std::endl;
     return str;
   }
 
@@ -77,6 +79,11 @@ namespace mt_kahypar {
     #ifdef USE_GRAPH_PARTITIONER
     str << "  Disable C. D. for Mesh Graphs:      " << std::boolalpha << params.disable_community_detection_for_mesh_graphs << std::endl;
     #endif
+    str << "  Node Ordering:                      " << params.node_ordering << std::endl;
+    str << "  Contract Twin Vertices:             " << std::boolalpha << params.contract_twin_vertices << std::endl;
+    str << "  Merge Identical Nets:               " << std::boolalpha << params.merge_identical_nets << std::endl;
+    str << "  Cache Communities:                  " << std::boolalpha << params.cache_communities << std::endl;
+    str << "  Use Precomputed Communities:        " << std::boolalpha << params.use_precomputed_communities << std::endl;
     if (params.use_community_detection) {
       str << std::endl << params.community_detection;
     }
@@ -111,7 +118,16 @@ namespace mt_kahypar {
     str << "  Minimum Shrink Factor:              " << params.minimum_shrink_factor << std::endl;
     str << "  Maximum Shrink Factor:              " << params.maximum_shrink_factor << std::endl;
     str << "  Vertex Degree Sampling Threshold:   " << params.vertex_degree_sampling_threshold << std::endl;
+    str << "  Large Net Sampling Threshold:       " << params.large_net_sampling_threshold << std::endl;
+    if ( params.large_net_sampling_threshold != std::numeric_limits<size_t>::max() ) {
+      str << "  Large Net Sample Size:              " << params.large_net_sample_size << std::endl;
+    }
     str << "  Number of subrounds (deterministic):" << params.num_sub_rounds_deterministic << std::endl;
+    str << "  Counting Sort Contraction:          " << std::boolalpha << params.counting_sort_contraction << std::endl;
+    str << "  Use Two-Hop Clustering:             " << std::boolalpha << params.use_two_hop_clustering << std::endl;
+    if ( params.use_two_hop_clustering ) {
+      str << "  Two-Hop Shrink Factor Threshold:    " << params.two_hop_shrink_factor_threshold << std::endl;
+    }
     str << std::endl << params.rating;
     return str;
   }
@@ -123,6 +139,7 @@ namespace mt_kahypar {
       str << "    Maximum Iterations:               " << params.maximum_iterations << std::endl;
       str << "    Rebalancing:                      " << std::boolalpha << params.rebalancing << std::endl;
       str << "    HE Size Activation Threshold:     " << std::boolalpha << params.hyperedge_size_activation_threshold << std::endl;
+      str << "    Cache Block Size:                 " << params.cache_block_size << std::endl;
     }
     return str;
   }
@@ -141,6 +158,8 @@ namespace mt_kahypar {
       out << "    Minimum Improvement Factor:       " << params.min_improvement << std::endl;
       out << "    Release Nodes:                    " << std::boolalpha << params.release_nodes << std::endl;
       out << "    Time Limit Factor:                " << params.time_limit_factor << std::endl;
+      out << "    Delta Memory Fraction:            " << params.delta_memory_fraction << std::endl;
+      out << "    Bucket PQ Gain Range:             " << params.bucket_pq_gain_range << std::endl;
     }
     out << std::flush;
     return out;
@@ -182,6 +201,7 @@ namespace mt_kahypar {
     out << "    Use active node set:               " << std::boolalpha << params.use_active_node_set << std::endl;
     out << "    recalculate gains on second apply: " << std::boolalpha
         << params.recalculate_gains_on_second_apply << std::endl;
+    out << "    Number of sub-rounds for FM:       " << params.num_sub_rounds_fm << std::endl;
     return out;
   }
 
@@ -243,6 +263,9 @@ namespace mt_kahypar {
     str << "  Number of used NUMA nodes:          " << TBBInitializer::instance().num_used_numa_nodes() << std::endl;
     str << "  Use Localized Random Shuffle:       " << std::boolalpha << params.use_localized_random_shuffle << std::endl;
     str << "  Random Shuffle Block Size:          " << params.shuffle_block_size << std::endl;
+    if ( params.memory_budget > 0 ) {
+      str << "  Memory Budget:                      " << params.memory_budget << " MB" << std::endl;
+    }
     return str;
   }
 
@@ -440,13 +463,22 @@ namespace mt_kahypar {
     if ( partition.deterministic ) {
       coarsening.algorithm = CoarseningAlgorithm::deterministic_multilevel_coarsener;
 
-      // disable FM until we have a deterministic version
-      refinement.fm.algorithm = FMAlgorithm::do_nothing;
-      initial_partitioning.refinement.fm.algorithm = FMAlgorithm::do_nothing;
-
       // disable adaptive IP
       initial_partitioning.use_adaptive_ip_runs = false;
 
+      // the recursion tree and the contraction limit of deep multilevel
+      // partitioning depend on the number of threads
+      if ( partition.mode == Mode::deep_multilevel ) {
+        WARNING("Deep multilevel partitioning is not deterministic."
+                << "Switching to" << Mode::direct << "mode.");
+        partition.mode = Mode::direct;
+      }
+      if ( initial_partitioning.mode == Mode::deep_multilevel ) {
+        WARNING("Deep multilevel initial partitioning is not deterministic."
+                << "Switching to" << Mode::recursive_bipartitioning << "mode.");
+        initial_partitioning.mode = Mode::recursive_bipartitioning;
+      }
+
 
       // switch silently
       auto lp_algo = refinement.label_propagation.algorithm;
@@ -458,21 +490,43 @@ namespace mt_kahypar {
       if ( lp_algo != LabelPropagationAlgorithm::do_nothing && lp_algo != LabelPropagationAlgorithm::deterministic ) {
         initial_partitioning.refinement.label_propagation.algorithm = LabelPropagationAlgorithm::deterministic;
       }
+
+      // the rebalancer is skipped in deterministic mode => the rollback must not violate the balance constraint
+      if ( refinement.fm.algorithm != FMAlgorithm::do_nothing ) {
+        refinement.fm.algorithm = FMAlgorithm::deterministic;
+        refinement.fm.rollback_balance_violation_factor = 1.0;
+      }
+      if ( initial_partitioning.refinement.fm.algorithm != FMAlgorithm::do_nothing ) {
+        initial_partitioning.refinement.fm.algorithm = FMAlgorithm::deterministic;
+        initial_partitioning.refinement.fm.rollback_balance_violation_factor = 1.0;
+      }
+
+      // disable flows until we have a deterministic version
+      refinement.flows.algorithm = FlowAlgorithm::do_nothing;
     }
   }
 
   void Context::setupThreadsPerFlowSearch() {
     if ( refinement.flows.algorithm == FlowAlgorithm::flow_cutter ) {
-      // = min(t, min(tau * k, k * (k - 1) / 2))
-      // t = number of threads
-      // k * (k - 1) / 2 = maximum number of edges in the quotient graph
-      refinement.flows.num_parallel_searches = partition.k == 2 ? 1 :
-        std::min(shared_memory.num_threads, std::min(std::max(1UL, static_cast<size_t>(
-          refinement.flows.parallel_searches_multiplier * partition.k)),
-            static_cast<size_t>((partition.k * (partition.k - 1)) / 2) ));
+      refinement.flows.num_parallel_searches = numParallelFlowSearches();
     }
   }
 
+  HypernodeID Context::largeHyperedgeThreshold() const {
+    return std::max(partition.large_hyperedge_size_threshold,
+                    partition.smallest_large_he_size_threshold);
+  }
+
+  size_t Context::numParallelFlowSearches() const {
+    // = min(t, min(tau * k, k * (k - 1) / 2))
+    // t = number of threads
+    // k * (k - 1) / 2 = maximum number of edges in the quotient graph
+    return partition.k == 2 ? 1 :
+      std::min(shared_memory.num_threads, std::min(std::max(1UL, static_cast<size_t>(
+        refinement.flows.parallel_searches_multiplier * partition.k)),
+          static_cast<size_t>((partition.k * (partition.k - 1)) / 2) ));
+  }
+
   void Context::load_default_preset() {
     // General
     partition.large_hyperedge_size_threshold_factor = 0.01;
@@ -684,14 +738,16 @@ namespace mt_kahypar {
     // refinement -> deterministic
     refinement.deterministic_refinement.num_sub_rounds_sync_lp = 1;
     refinement.deterministic_refinement.use_active_node_set = true;
+    refinement.deterministic_refinement.num_sub_rounds_fm = 4;
 
     // refinement -> fm
-    refinement.fm.algorithm = FMAlgorithm::do_nothing;
+    refinement.fm.algorithm = FMAlgorithm::deterministic;
     refinement.fm.multitry_rounds = 10;
     refinement.fm.perform_moves_global = false;
     refinement.fm.rollback_parallel = true;
-    refinement.fm.rollback_balance_violation_factor = 1.25;
+    refinement.fm.rollback_balance_violation_factor = 1.0;
     refinement.fm.num_seed_nodes = 25;
+    refinement.fm.min_improvement = -1.0;
     refinement.fm.obey_minimal_parallelism = true;
     refinement.fm.release_nodes = true;
     refinement.fm.time_limit_factor = 0.25;
@@ -56,6 +56,8 @@ struct PartitioningParameters {
   HypernodeID large_hyperedge_size_threshold = std::numeric_limits<HypernodeID>::max();
   HypernodeID smallest_large_he_size_threshold = std::numeric_limits<HypernodeID>::max();
   HypernodeID ignore_hyperedge_size_threshold = std::numeric_limits<HypernodeID>::max();
+  // ! If true, large hyperedges are not removed. Instead, they are excluded from the gain cache.
+  bool approximate_large_hyperedges = false;
 
   bool verbose_output = true;
   bool show_detailed_timings = false;
@@ -74,6 +76,7 @@ struct PartitioningParameters {
   std::string graph_partition_output_folder {};
   std::string graph_partition_filename { };
   std::string graph_community_filename { };
+  std::string graph_community_cache_filename { };
   std::string preset_file { };
 };
 
@@ -83,6 +86,8 @@ struct CommunityDetectionParameters {
   LouvainEdgeWeight edge_weight_function = LouvainEdgeWeight::UNDEFINED;
   uint32_t max_pass_iterations = std::numeric_limits<uint32_t>::max();
   bool low_memory_contraction = false;
+  // ! If true, the first level of the Louvain method runs on an implicit star expansion
+  bool implicit_star_expansion = false;
   long double min_vertex_move_fraction = std::numeric_limits<long double>::max();
   size_t vertex_degree_sampling_threshold = std::numeric_limits<size_t>::max();
   size_t num_sub_rounds_deterministic = 16;
@@ -94,6 +99,15 @@ struct PreprocessingParameters {
   bool stable_construction_of_incident_edges = false;
   bool use_community_detection = false;
   bool disable_community_detection_for_mesh_graphs = true;
+  // ! Communities are read from (and written to) partition.graph_community_cache_filename
+  bool cache_communities = false;
+  // ! Skips community detection and uses the community IDs already stored in the hypergraph
+  bool use_precomputed_communities = false;
+  NodeOrdering node_ordering = NodeOrdering::none;
+  // ! Contracts vertices with identical sets of incident nets before partitioning
+  bool contract_twin_vertices = false;
+  // ! Merges nets with identical pin sets (their weights are summed up) before partitioning
+  bool merge_identical_nets = false;
   CommunityDetectionParameters community_detection = { };
 };
 
@@ -119,7 +133,18 @@ struct CoarseningParameters {
   double minimum_shrink_factor = std::numeric_limits<double>::max();
   double maximum_shrink_factor = std::numeric_limits<double>::max();
   size_t vertex_degree_sampling_threshold = std::numeric_limits<size_t>::max();
+  // ! Only a random sample of large_net_sample_size pins is rated for
+  // ! hyperedges with more than large_net_sampling_threshold pins
+  size_t large_net_sampling_threshold = std::numeric_limits<size_t>::max();
+  size_t large_net_sample_size = 1000;
   size_t num_sub_rounds_deterministic = 16;
+  // ! If true, contracted pins and incident nets are deduplicated with
+  // ! counting sorts instead of comparison-based sorting
+  bool counting_sort_contraction = false;
+  // ! Unmatched vertices with a common favorite neighbor are clustered, if
+  // ! a clustering pass shrinks the hypergraph by less than the threshold
+  bool use_two_hop_clustering = false;
+  double two_hop_shrink_factor_threshold = 2.0;
 
   // Those will be determined dynamically
   HypernodeWeight max_allowed_node_weight = 0;
@@ -135,6 +160,7 @@ struct LabelPropagationParameters {
   bool rebalancing = true;
   bool execute_sequential = false;
   size_t hyperedge_size_activation_threshold = std::numeric_limits<size_t>::max();
+  size_t cache_block_size = 0;
 };
 
 std::ostream & operator<< (std::ostream& str, const LabelPropagationParameters& params);
@@ -148,6 +174,8 @@ struct FMParameters {
   double rollback_balance_violation_factor = std::numeric_limits<double>::max();
   double min_improvement = -1.0;
   double time_limit_factor = std::numeric_limits<double>::max();
+  double delta_memory_fraction = 0.5;
+  Gain bucket_pq_gain_range = 0;
 
   bool perform_moves_global = false;
   bool rollback_parallel = true;
@@ -190,6 +218,8 @@ struct DeterministicRefinementParameters {
   size_t num_sub_rounds_sync_lp = 5;
   bool use_active_node_set = false;
   bool recalculate_gains_on_second_apply = false;
+  // ! Number of synchronous sub-rounds of localized searches per deterministic FM round
+  size_t num_sub_rounds_fm = 4;
 };
 
 std::ostream& operator<<(std::ostream& out, const DeterministicRefinementParameters& params);
@@ -249,6 +279,7 @@ struct SharedMemoryParameters {
   bool use_localized_random_shuffle = false;
   size_t shuffle_block_size = 2;
   double degree_of_parallelism = 1.0;
+  size_t memory_budget = 0; // in MB (0 = unlimited)
 };
 
 std::ostream & operator<< (std::ostream& str, const SharedMemoryParameters& params);
@@ -286,6 +317,11 @@ class Context {
 
   void setupThreadsPerFlowSearch();
 
+  size_t numParallelFlowSearches() const;
+
+  // ! Hyperedges with more pins are removed (or approximated) during partitioning
+  HypernodeID largeHyperedgeThreshold() const;
+
   void sanityCheck();
 
   void load_default_preset();
@@ -27,6 +27,8 @@
 
 #include "context_enum_classes.h"
 
+#include <stdexcept>
+
 #include "mt-kahypar/macros.h"
 
 namespace mt_kahypar {
@@ -125,6 +127,17 @@ namespace mt_kahypar {
     return os << static_cast<uint8_t>(type);
   }
 
+  std::ostream & operator<< (std::ostream& os, const NodeOrdering& ordering) {
+    switch (ordering) {
+      case NodeOrdering::none: return os << "none";
+      case NodeOrdering::bfs: return os << "bfs";
+      case NodeOrdering::communities: return os << "communities";
+      case NodeOrdering::UNDEFINED: return os << "UNDEFINED";
+        // omit default case to trigger compiler warning for missing cases
+    }
+    return os << static_cast<uint8_t>(ordering);
+  }
+
   std::ostream & operator<< (std::ostream& os, const SimiliarNetCombinerStrategy& strategy) {
     switch (strategy) {
       case SimiliarNetCombinerStrategy::union_nets: return os << "union";
@@ -211,6 +224,7 @@ namespace mt_kahypar {
       case FMAlgorithm::fm_gain_cache_on_demand : return os << "fm_gain_cache_on_demand";
       case FMAlgorithm::fm_gain_delta: return os << "fm_gain_delta";
       case FMAlgorithm::fm_recompute_gain: return os << "fm_recompute_gain";
+      case FMAlgorithm::deterministic: return os << "deterministic";
       case FMAlgorithm::do_nothing: return os << "fm_do_nothing";
         // omit default case to trigger compiler warning for missing cases
     }
@@ -235,7 +249,7 @@ namespace mt_kahypar {
     } else if (mode == "deep") {
       return Mode::deep_multilevel;
     }
-    ERROR("Illegal option: " + mode);
+    throw std::invalid_argument("Illegal option: " + mode);
     return Mode::UNDEFINED;
   }
 
@@ -245,7 +259,7 @@ namespace mt_kahypar {
     } else if (type == "hypergraph") {
       return InstanceType::hypergraph;
     }
-    ERROR("Illegal option: " + type);
+    throw std::invalid_argument("Illegal option: " + type);
     return InstanceType::UNDEFINED;
   }
 
@@ -261,7 +275,7 @@ namespace mt_kahypar {
     } else if (type == "quality_flows") {
       return PresetType::quality_flows;
     }
-    ERROR("Illegal option: " + type);
+    throw std::invalid_argument("Illegal option: " + type);
     return PresetType::UNDEFINED;
   }
 
@@ -275,10 +289,22 @@ namespace mt_kahypar {
     } else if (type == "degree") {
       return LouvainEdgeWeight::degree;
     }
-    ERROR("No valid louvain edge weight.");
+    throw std::invalid_argument("No valid louvain edge weight.");
     return LouvainEdgeWeight::UNDEFINED;
   }
 
+  NodeOrdering nodeOrderingFromString(const std::string& ordering) {
+    if (ordering == "none") {
+      return NodeOrdering::none;
+    } else if (ordering == "bfs") {
+      return NodeOrdering::bfs;
+    } else if (ordering == "communities") {
+      return NodeOrdering::communities;
+    }
+    throw std::invalid_argument("No valid node ordering.");
+    return NodeOrdering::UNDEFINED;
+  }
+
   SimiliarNetCombinerStrategy similiarNetCombinerStrategyFromString(const std::string& type) {
     if (type == "union") {
       return SimiliarNetCombinerStrategy::union_nets;
@@ -287,7 +313,7 @@ namespace mt_kahypar {
     } else if (type == "importance") {
       return SimiliarNetCombinerStrategy::importance;
     }
-    ERROR("No valid similiar net unifier strategy.");
+    throw std::invalid_argument("No valid similiar net unifier strategy.");
     return SimiliarNetCombinerStrategy::UNDEFINED;
   }
 
@@ -299,7 +325,7 @@ namespace mt_kahypar {
     } else if (type == "deterministic_multilevel_coarsener") {
       return CoarseningAlgorithm::deterministic_multilevel_coarsener;
     }
-    ERROR("Illegal option: " + type);
+    throw std::invalid_argument("Illegal option: " + type);
     return CoarseningAlgorithm::UNDEFINED;
   }
 
@@ -312,7 +338,7 @@ namespace mt_kahypar {
       return HeavyNodePenaltyPolicy::additive;
       // omit default case to trigger compiler warning for missing cases
     }
-    ERROR("No valid edge penalty policy for rating.");
+    throw std::invalid_argument("No valid edge penalty policy for rating.");
     return HeavyNodePenaltyPolicy::UNDEFINED;
   }
 
@@ -322,7 +348,7 @@ namespace mt_kahypar {
     } else if (crit == "best_prefer_unmatched") {
       return AcceptancePolicy::best_prefer_unmatched;
     }
-    ERROR("No valid acceptance criterion for rating.");
+    throw std::invalid_argument("No valid acceptance criterion for rating.");
   }
 
   RatingFunction ratingFunctionFromString(const std::string& function) {
@@ -331,7 +357,7 @@ namespace mt_kahypar {
     } else  if (function == "sameness") {
       return RatingFunction::sameness;
     }
-    ERROR("No valid rating function for rating.");
+    throw std::invalid_argument("No valid rating function for rating.");
     return RatingFunction::UNDEFINED;
   }
 
@@ -355,7 +381,7 @@ namespace mt_kahypar {
     } else if (algo == "label_propagation") {
       return InitialPartitioningAlgorithm::label_propagation;
     }
-    ERROR("Illegal option: " + algo);
+    throw std::invalid_argument("Illegal option: " + algo);
     return InitialPartitioningAlgorithm::UNDEFINED;
   }
 
@@ -369,7 +395,7 @@ namespace mt_kahypar {
     } else if (type == "do_nothing") {
       return LabelPropagationAlgorithm::do_nothing;
     }
-    ERROR("Illegal option: " + type);
+    throw std::invalid_argument("Illegal option: " + type);
     return LabelPropagationAlgorithm::do_nothing;
   }
 
@@ -382,10 +408,12 @@ namespace mt_kahypar {
       return FMAlgorithm::fm_gain_delta;
     } else if (type == "fm_recompute_gain") {
       return FMAlgorithm::fm_recompute_gain;
+    } else if (type == "deterministic") {
+      return FMAlgorithm::deterministic;
     } else if (type == "do_nothing") {
       return FMAlgorithm::do_nothing;
     }
-    ERROR("Illegal option: " + type);
+    throw std::invalid_argument("Illegal option: " + type);
     return FMAlgorithm::do_nothing;
   }
 
@@ -395,7 +423,7 @@ namespace mt_kahypar {
     } else if (type == "do_nothing") {
       return FlowAlgorithm::do_nothing;
     }
-    ERROR("Illegal option: " + type);
+    throw std::invalid_argument("Illegal option: " + type);
     return FlowAlgorithm::do_nothing;
   }
 }
\ No newline at end of file
@@ -90,6 +90,13 @@ enum class LouvainEdgeWeight : uint8_t {
   UNDEFINED
 };
 
+enum class NodeOrdering : uint8_t {
+  none,
+  bfs,
+  communities,
+  UNDEFINED
+};
+
 enum class SimiliarNetCombinerStrategy : uint8_t {
   union_nets,
   max_size,
@@ -148,6 +155,7 @@ enum class FMAlgorithm : uint8_t {
   fm_gain_cache_on_demand,
   fm_gain_delta,
   fm_recompute_gain,
+  deterministic,
   do_nothing
 };
 
@@ -175,6 +183,8 @@ std::ostream & operator<< (std::ostream& os, const Objective& objective);
 
 std::ostream & operator<< (std::ostream& os, const LouvainEdgeWeight& type);
 
+std::ostream & operator<< (std::ostream& os, const NodeOrdering& ordering);
+
 std::ostream & operator<< (std::ostream& os, const SimiliarNetCombinerStrategy& strategy);
 
 std::ostream & operator<< (std::ostream& os, const CoarseningAlgorithm& algo);
@@ -201,6 +211,8 @@ PresetType presetTypeFromString(const std::string& type);
 
 LouvainEdgeWeight louvainEdgeWeightFromString(const std::string& type);
 
+NodeOrdering nodeOrderingFromString(const std::string& ordering);
+
 SimiliarNetCombinerStrategy similiarNetCombinerStrategyFromString(const std::string& type);
 
 CoarseningAlgorithm coarseningAlgorithmFromString(const std::string& type);
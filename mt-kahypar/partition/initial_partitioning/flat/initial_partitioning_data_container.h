@@ -183,16 +183,21 @@ class InitialPartitioningDataContainer {
     HyperedgeWeight _best_quality;
   };
 
+  // ! Thread-local partition state of the flat initial partitioners. All threads share
+  // ! the (read-only) coarsest hypergraph and each thread only stores its own block ids,
+  // ! block weights and pin counts. Since the partition is exclusively modified by the
+  // ! owning thread, pin count updates do not require any synchronization.
   struct LocalInitialPartitioningHypergraph {
 
     LocalInitialPartitioningHypergraph(Hypergraph& hypergraph,
                                        const Context& context,
                                        GlobalInitialPartitioningStats& global_stats,
                                        const bool disable_fm) :
-      _partitioned_hypergraph(context.partition.k, hypergraph),
+      _partitioned_hypergraph(context.partition.k, hypergraph, thread_exclusive_tag_t()),
       _context(context),
       _global_stats(global_stats),
-      _partition(hypergraph.initialNumNodes(), kInvalidPartition),
+      // In deterministic mode, the best partitions are stored in a shared pool
+      _partition(context.partition.deterministic ? 0 : hypergraph.initialNumNodes(), kInvalidPartition),
       _result(InitialPartitioningAlgorithm::UNDEFINED,
               std::numeric_limits<HypernodeWeight>::max(),
               std::numeric_limits<HypernodeWeight>::max(),
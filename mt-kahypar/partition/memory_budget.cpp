@@ -0,0 +1,224 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2021 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include "mt-kahypar/partition/memory_budget.h"
+
+#include <algorithm>
+
+#include "mt-kahypar/datastructures/connectivity_set.h"
+#include "mt-kahypar/datastructures/pin_count_in_part.h"
+#include "mt-kahypar/parallel/atomic_wrapper.h"
+#include "mt-kahypar/utils/memory_info.h"
+#include "mt-kahypar/utils/memory_tree.h"
+
+namespace mt_kahypar::memory_budget {
+
+  namespace {
+    static constexpr size_t BYTES_PER_MB = 1000UL * 1000UL;
+    // Rough size of the flow network per pin of a flow problem
+    static constexpr size_t FLOW_NETWORK_BYTES_PER_PIN = 64;
+    // Memory reserved for the local delta partition of each FM search
+    static constexpr size_t MIN_DELTA_MEMORY_PER_THREAD = 4UL * BYTES_PER_MB;
+    // Number of threads assumed by the estimate in deterministic mode
+    static constexpr size_t DETERMINISTIC_REFERENCE_NUM_THREADS = 64;
+
+    struct MemoryEstimate {
+      size_t input = 0;
+      size_t input_copies = 0;
+      size_t preprocessing = 0;
+      size_t reordering = 0;
+      size_t coarsening = 0;
+      size_t initial_partitioning = 0;
+      size_t refinement = 0;
+      size_t flows = 0;
+      size_t postprocessing = 0;
+
+      // The input hypergraph (or its reordered copy) and the reduced hypergraph are
+      // alive all the time and the coarsening hierarchy also during initial partitioning
+      // and refinement. The memory pool reuses the memory of community detection in
+      // later phases.
+      size_t peak() const {
+        return input + input_copies + std::max({ preprocessing, reordering,
+          coarsening + std::max(initial_partitioning, refinement + flows), postprocessing });
+      }
+    };
+
+    // The algorithms selected by enforceMemoryBudget() are part of the result. In deterministic
+    // mode, they must not depend on the number of threads, so we assume a fixed (conservative)
+    // number of threads instead.
+    size_t numThreads(const Context& context) {
+      return context.partition.deterministic ?
+        DETERMINISTIC_REFERENCE_NUM_THREADS : context.shared_memory.num_threads;
+    }
+
+    size_t sizeOf(const Hypergraph& hypergraph) {
+      utils::MemoryTreeNode root("Hypergraph", utils::OutputType::BYTES);
+      hypergraph.memoryConsumption(&root);
+      root.finalize();
+      return root.size_in_bytes();
+    }
+
+    MemoryEstimate estimate(const Hypergraph& hypergraph, const size_t input_size, const Context& context) {
+      const size_t num_nodes = hypergraph.initialNumNodes();
+      const size_t num_edges = hypergraph.initialNumEdges();
+      const size_t num_pins = hypergraph.initialNumPins();
+      const size_t k = context.partition.k;
+      const size_t num_threads = numThreads(context);
+
+      MemoryEstimate mem;
+      mem.input = input_size;
+
+      // The partitioner works on a reduced copy of the input hypergraph, if twin vertices
+      // are contracted or identical nets are merged (its size is bounded by the input size).
+      // Reordering creates a relabeled copy of the (reduced) input, which replaces it during
+      // partitioning. Without reduction, the input is rebuilt from the copy afterwards.
+      const bool reduce = context.preprocessing.contract_twin_vertices ||
+        context.preprocessing.merge_identical_nets;
+      const bool reorder = context.preprocessing.node_ordering != NodeOrdering::none;
+      if ( reduce ) {
+        mem.input_copies += input_size + num_nodes * sizeof(HypernodeID);
+      }
+      if ( reorder ) {
+        mem.input_copies += num_nodes * sizeof(HypernodeID) +
+          ( reduce ? 0 : num_edges * sizeof(HyperedgeID) );
+        mem.reordering = input_size;
+      }
+
+      // Star expansion of the hypergraph and its contracted version
+      if ( context.preprocessing.use_community_detection ) {
+        const bool is_graph = hypergraph.maxEdgeSize() == 2;
+        const size_t num_star_expansion_nodes = num_nodes + (is_graph ? 0 : num_edges);
+        const size_t num_star_expansion_edges = is_graph ? num_pins : (2UL * num_pins);
+        const size_t graph_size = (num_star_expansion_nodes + 1) * sizeof(size_t) +
+          num_star_expansion_edges * sizeof(Arc) + num_star_expansion_nodes * sizeof(ArcWeight);
+        if ( !is_graph && context.preprocessing.community_detection.implicit_star_expansion ) {
+          // only the node volumes of the finest level are materialized
+          mem.preprocessing = num_star_expansion_nodes * sizeof(ArcWeight) + graph_size;
+        } else {
+          mem.preprocessing = 2 * graph_size;
+        }
+        if ( !context.preprocessing.community_detection.low_memory_contraction ) {
+          mem.preprocessing += graph_size + num_star_expansion_nodes * sizeof(size_t) +
+            num_star_expansion_edges * sizeof(size_t);
+        }
+      }
+
+      // Coarser levels of the hierarchy and the temporary buffers of the contraction
+      mem.coarsening = 2 * input_size;
+      if ( !Hypergraph::is_graph && context.coarsening.counting_sort_contraction ) {
+        // The counting sort contraction sorts (vertex, net) pairs into a second array
+        mem.coarsening += 2 * num_pins * (sizeof(HypernodeID) + sizeof(HyperedgeID));
+      }
+
+      // Each thread partitions a copy of the coarsest hypergraph and the best partitions are kept
+      const double coarsest_fraction = std::min(1.0,
+        static_cast<double>(context.coarsening.contraction_limit_multiplier) * k / std::max(num_nodes, 1UL));
+      const size_t coarsest_size = coarsest_fraction * input_size;
+      const size_t coarsest_num_nodes = coarsest_fraction * num_nodes;
+      mem.initial_partitioning = num_threads * 2 * coarsest_size +
+        context.initial_partitioning.population_size * coarsest_num_nodes * sizeof(PartitionID);
+
+      // Partitioned hypergraph
+      size_t partition_size = num_nodes * sizeof(PartitionID);
+      if ( !Hypergraph::is_graph ) {
+        partition_size += ds::PinCountInPart::num_elements(num_edges, k, hypergraph.maxEdgeSize()) *
+          sizeof(ds::PinCountInPart::Value);
+        partition_size += ds::ConnectivitySets::num_elements(num_edges, k) *
+          sizeof(ds::ConnectivitySets::UnsafeBlock);
+      }
+      mem.refinement = partition_size;
+      const bool uses_gain_cache =
+        context.refinement.fm.algorithm == FMAlgorithm::fm_gain_cache ||
+        context.refinement.fm.algorithm == FMAlgorithm::fm_gain_cache_on_demand;
+      if ( Hypergraph::is_graph ) {
+        if ( context.refinement.fm.algorithm != FMAlgorithm::do_nothing ) {
+          mem.refinement += num_nodes * (k + 1) * sizeof(CAtomic<HyperedgeWeight>);
+        }
+      } else if ( uses_gain_cache ) {
+        mem.refinement += num_nodes * (k + 1) * sizeof(CAtomic<HyperedgeWeight>);
+      }
+
+      // The partition is projected onto the (restored) input hypergraph
+      if ( reduce || reorder ) {
+        mem.postprocessing = 2 * partition_size + ( reorder && !reduce ? input_size : 0 );
+      }
+
+      // Flow networks of the parallel flow searches (flows are disabled
+      // in deterministic mode, see Context::sanityCheck())
+      if ( context.refinement.flows.algorithm != FlowAlgorithm::do_nothing && !context.partition.deterministic ) {
+        mem.flows = context.numParallelFlowSearches() *
+          std::min(static_cast<size_t>(context.refinement.flows.max_num_pins), num_pins) * FLOW_NETWORK_BYTES_PER_PIN;
+      }
+      return mem;
+    }
+  } // namespace
+
+  size_t estimatePeakMemory(const Hypergraph& hypergraph, const Context& context) {
+    return estimate(hypergraph, sizeOf(hypergraph), context).peak();
+  }
+
+  bool enforceMemoryBudget(const Hypergraph& hypergraph, Context& context) {
+    if ( context.shared_memory.memory_budget == 0 ) {
+      return true;
+    }
+
+    const size_t budget = context.shared_memory.memory_budget * BYTES_PER_MB;
+    const size_t input_size = sizeOf(hypergraph);
+    auto exceeds_budget = [&] {
+      return estimate(hypergraph, input_size, context).peak() > budget;
+    };
+
+    // Ordered by their expected impact on the solution quality
+    if ( exceeds_budget() ) {
+      context.preprocessing.community_detection.low_memory_contraction = true;
+    }
+    if ( exceeds_budget() ) {
+      context.preprocessing.community_detection.implicit_star_expansion = true;
+    }
+    while ( exceeds_budget() && context.refinement.flows.algorithm != FlowAlgorithm::do_nothing &&
+            !context.partition.deterministic && context.numParallelFlowSearches() > 1 ) {
+      context.refinement.flows.parallel_searches_multiplier /= 2;
+    }
+    while ( exceeds_budget() && context.initial_partitioning.population_size > 1 ) {
+      context.initial_partitioning.population_size /= 2;
+    }
+    if ( exceeds_budget() && ( context.refinement.fm.algorithm == FMAlgorithm::fm_gain_cache ||
+                               context.refinement.fm.algorithm == FMAlgorithm::fm_gain_cache_on_demand ) ) {
+      context.refinement.fm.algorithm = FMAlgorithm::fm_recompute_gain;
+    }
+    if ( exceeds_budget() ) {
+      context.preprocessing.use_community_detection = false;
+    }
+
+    // Local delta partitions of FM get the remaining budget
+    const size_t peak = estimate(hypergraph, input_size, context).peak();
+    const size_t delta_memory = std::max(budget > peak ? budget - peak : 0,
+      numThreads(context) * MIN_DELTA_MEMORY_PER_THREAD);
+    context.refinement.fm.delta_memory_fraction = std::min(context.refinement.fm.delta_memory_fraction,
+      static_cast<double>(delta_memory) / utils::physicalMemory());
+    return peak <= budget;
+  }
+}  // namespace mt_kahypar::memory_budget
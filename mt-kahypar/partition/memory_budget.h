@@ -0,0 +1,43 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2021 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include "mt-kahypar/definitions.h"
+#include "mt-kahypar/partition/context.h"
+
+namespace mt_kahypar::memory_budget {
+  // ! Estimates the peak memory consumption (in bytes) of partitioning the
+  // ! hypergraph with the given context
+  size_t estimatePeakMemory(const Hypergraph& hypergraph, const Context& context);
+
+  // ! If the estimated peak memory consumption exceeds the memory budget of the
+  // ! context (shared_memory.memory_budget), algorithms that require less memory are
+  // ! selected step by step until the estimate fits into the budget. Afterwards, the
+  // ! remaining budget is assigned to the local delta partitions of FM.
+  // ! Returns false, if the estimate still exceeds the budget.
+  bool enforceMemoryBudget(const Hypergraph& hypergraph, Context& context);
+}  // namespace mt_kahypar::memory_budget
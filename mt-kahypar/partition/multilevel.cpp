@@ -382,6 +382,80 @@ void partition_async(Hypergraph& hypergraph, PartitionedHypergraph& partitioned_
 }
 
 
+void partitionForMultipleK(Hypergraph& hypergraph,
+                           const Context& coarsening_context,
+                           const vec<Context>& contexts,
+                           const std::function<void(const size_t, PartitionedHypergraph&)>& on_partitioned) {
+  ASSERT(!contexts.empty());
+  ASSERT(coarsening_context.coarsening.algorithm != CoarseningAlgorithm::nlevel_coarsener);
+  UncoarseningData uncoarseningData(false, hypergraph, coarsening_context);
+  utils::Utilities& utils = utils::Utilities::instance();
+  utils::Timer& timer = utils.getTimer(coarsening_context.utility_id);
+
+  // ################## COARSENING ##################
+  io::printCoarseningBanner(coarsening_context);
+  timer.start_timer("coarsening", "Coarsening");
+  std::unique_ptr<ICoarsener> coarsener = CoarsenerFactory::getInstance().createObject(
+    coarsening_context.coarsening.algorithm, hypergraph, coarsening_context, uncoarseningData);
+  coarsener->coarsen();
+  coarsener.reset();
+  timer.stop_timer("coarsening");
+
+  for ( size_t i = 0; i < contexts.size(); ++i ) {
+    const Context& context = contexts[i];
+    ASSERT(i == 0 || contexts[i - 1].coarsening.contraction_limit <= context.coarsening.contraction_limit);
+    ASSERT(coarsening_context.coarsening.max_allowed_node_weight <= context.coarsening.max_allowed_node_weight);
+    uncoarseningData.reuseHierarchy(context);
+    PartitionedHypergraph& coarsest_phg = uncoarseningData.coarsestPartitionedHypergraph();
+
+    // ################## INITIAL PARTITIONING ##################
+    io::printInitialPartitioningBanner(context);
+    timer.start_timer("initial_partitioning", "Initial Partitioning");
+    Context ip_context(context);
+    ip_context.refinement = context.initial_partitioning.refinement;
+    DegreeZeroHypernodeRemover degree_zero_hn_remover(context);
+    if ( context.initial_partitioning.remove_degree_zero_hns_before_ip ) {
+      degree_zero_hn_remover.removeDegreeZeroHypernodes(coarsest_phg.hypergraph());
+    }
+    if ( context.initial_partitioning.mode == Mode::direct ) {
+      parallel::MemoryPool::instance().deactivate_unused_memory_allocations();
+      utils.getTimer(context.utility_id).disable();
+      utils.getStats(context.utility_id).disable();
+      PoolInitialPartitioner& ip_task = *new(tbb::task::allocate_root())
+        PoolInitialPartitioner(coarsest_phg, ip_context);
+      tbb::task::spawn_root_and_wait(ip_task);
+      parallel::MemoryPool::instance().activate_unused_memory_allocations();
+      utils.getTimer(context.utility_id).enable();
+      utils.getStats(context.utility_id).enable();
+    } else {
+      std::unique_ptr<IInitialPartitioner> initial_partitioner =
+        InitialPartitionerFactory::getInstance().createObject(
+          ip_context.initial_partitioning.mode, coarsest_phg, ip_context);
+      initial_partitioner->initialPartition();
+    }
+    degree_zero_hn_remover.restoreDegreeZeroHypernodes(coarsest_phg);
+    timer.stop_timer("initial_partitioning");
+    io::printPartitioningResults(coarsest_phg, context, "Initial Partitioning Results:");
+
+    // ################## LOCAL SEARCH ##################
+    io::printLocalSearchBanner(context);
+    timer.start_timer("refinement", "Refinement");
+    std::unique_ptr<IRefiner> label_propagation =
+      LabelPropagationFactory::getInstance().createObject(
+        context.refinement.label_propagation.algorithm, hypergraph, context);
+    std::unique_ptr<IRefiner> fm =
+      FMFactory::getInstance().createObject(
+        context.refinement.fm.algorithm, hypergraph, context);
+    MultilevelUncoarsener uncoarsener(hypergraph, context, uncoarseningData);
+    PartitionedHypergraph partitioned_hypergraph = uncoarsener.uncoarsen(label_propagation, fm);
+    timer.stop_timer("refinement");
+    io::printPartitioningResults(partitioned_hypergraph, context, "Local Search Results:");
+
+    on_partitioned(i, partitioned_hypergraph);
+  }
+}
+
+
 void partitionVCycle(Hypergraph& hypergraph, PartitionedHypergraph& partitioned_hypergraph,
                      const Context& context) {
   VCycleTask& vcycle_task = *new(tbb::task::allocate_root())
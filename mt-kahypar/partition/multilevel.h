@@ -27,6 +27,8 @@
 
 #pragma once
 
+#include <functional>
+
 #include "mt-kahypar/definitions.h"
 #include "mt-kahypar/partition/context.h"
 
@@ -42,6 +44,19 @@ PartitionedHypergraph partition(Hypergraph& hypergraph, const Context& context);
 void partition_async(Hypergraph& hypergraph, PartitionedHypergraph& partitioned_hypergraph,
                      const Context& context, tbb::task* parent);
 
+// ! Coarsens the hypergraph only once and computes a partition for each of the
+// ! given contexts (e.g., different numbers of blocks) by running initial
+// ! partitioning and uncoarsening on the shared multilevel hierarchy. The contexts
+// ! must be sorted in increasing order of their contraction limits, and the
+// ! hierarchy is built with the coarsening context, whose contraction limit and
+// ! maximum allowed node weight must not exceed the ones of any context. The callback
+// ! receives the index of the context and the resulting partition before the next
+// ! context is processed.
+void partitionForMultipleK(Hypergraph& hypergraph,
+                           const Context& coarsening_context,
+                           const vec<Context>& contexts,
+                           const std::function<void(const size_t, PartitionedHypergraph&)>& on_partitioned);
+
 // ! Performs a multilevel partitioning v-cycle on the given hypergraph
 // ! in TBB blocking-style.
 void partitionVCycle(Hypergraph& hypergraph, PartitionedHypergraph& partitioned_hypergraph,
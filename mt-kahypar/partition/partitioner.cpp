@@ -27,13 +27,20 @@
 
 #include "partitioner.h"
 
+#include <algorithm>
+#include <numeric>
+
 #include "mt-kahypar/io/partitioning_output.h"
 #include "mt-kahypar/partition/multilevel.h"
 #include "mt-kahypar/partition/preprocessing/sparsification/degree_zero_hn_remover.h"
 #include "mt-kahypar/partition/preprocessing/sparsification/large_he_remover.h"
+#include "mt-kahypar/partition/preprocessing/community_detection/community_cache.h"
 #include "mt-kahypar/partition/preprocessing/community_detection/parallel_louvain.h"
+#include "mt-kahypar/partition/preprocessing/reduction/hypergraph_reduction.h"
+#include "mt-kahypar/partition/preprocessing/reordering/hypergraph_reordering.h"
 #include "mt-kahypar/partition/recursive_bipartitioning.h"
 #include "mt-kahypar/partition/deep_multilevel.h"
+#include "mt-kahypar/partition/memory_budget.h"
 #include "mt-kahypar/utils/hypergraph_statistics.h"
 #include "mt-kahypar/utils/stats.h"
 #include "mt-kahypar/utils/timer.h"
@@ -42,6 +49,12 @@
 namespace mt_kahypar {
 
   void setupContext(Hypergraph& hypergraph, Context& context) {
+    const bool fits_into_memory_budget = memory_budget::enforceMemoryBudget(hypergraph, context);
+    if ( !fits_into_memory_budget && context.partition.verbose_output ) {
+      WARNING("Estimated memory consumption of"
+        << memory_budget::estimatePeakMemory(hypergraph, context) / 1000000 << "MB exceeds the"
+        << "memory budget of" << context.shared_memory.memory_budget << "MB");
+    }
     context.partition.large_hyperedge_size_threshold = std::max(hypergraph.initialNumNodes() *
                                                                 context.partition.large_hyperedge_size_threshold_factor, 100.0);
     context.sanityCheck();
@@ -162,7 +175,15 @@ namespace mt_kahypar {
     bool is_graph = false;
 
     utils::Timer& timer = utils::Utilities::instance().getTimer(context.utility_id);
-    if ( context.preprocessing.use_community_detection ) {
+    if ( context.preprocessing.use_precomputed_communities ) {
+      // Community IDs were passed by the caller via Hypergraph::setCommunityIDs(...)
+      use_community_detection = false;
+      if (context.partition.verbose_output) {
+        io::printCommunityInformation(hypergraph);
+      }
+    }
+
+    if ( use_community_detection ) {
       timer.start_timer("detect_graph_structure", "Detect Graph Structure");
       is_graph = isGraph(hypergraph);
       if ( is_graph && context.preprocessing.disable_community_detection_for_mesh_graphs ) {
@@ -175,17 +196,50 @@ namespace mt_kahypar {
       io::printTopLevelPreprocessingBanner(context);
 
       timer.start_timer("community_detection", "Community Detection");
-      timer.start_timer("construct_graph", "Construct Graph");
-      Graph graph(hypergraph, context.preprocessing.community_detection.edge_weight_function, is_graph);
-      if ( !context.preprocessing.community_detection.low_memory_contraction ) {
-        graph.allocateContractionBuffers();
+      const bool use_cache = context.preprocessing.cache_communities &&
+        !context.partition.graph_community_cache_filename.empty();
+      community_detection::CommunityCacheKey cache_key { };
+      ds::Clustering communities;
+      bool found_in_cache = false;
+      if ( use_cache ) {
+        timer.start_timer("read_community_cache", "Read Community Cache");
+        cache_key = community_detection::computeCommunityCacheKey(hypergraph, context);
+        found_in_cache = community_detection::readCommunityCache(
+          context.partition.graph_community_cache_filename, cache_key, communities);
+        timer.stop_timer("read_community_cache");
+        if ( found_in_cache && context.partition.verbose_output ) {
+          LOG << "Read communities from" << context.partition.graph_community_cache_filename;
+        }
+      }
+
+      if ( !found_in_cache ) {
+        if ( !is_graph && context.preprocessing.community_detection.implicit_star_expansion ) {
+          // The star expansion is read directly from the hypergraph
+          timer.start_timer("construct_graph", "Construct Graph");
+          StarExpansionGraph graph(hypergraph, context.preprocessing.community_detection.edge_weight_function);
+          timer.stop_timer("construct_graph");
+          timer.start_timer("perform_community_detection", "Perform Community Detection");
+          communities = community_detection::run_parallel_louvain(graph, context);
+          graph.restrictClusteringToHypernodes(hypergraph, communities);
+          timer.stop_timer("perform_community_detection");
+        } else {
+          timer.start_timer("construct_graph", "Construct Graph");
+          Graph graph(hypergraph, context.preprocessing.community_detection.edge_weight_function, is_graph);
+          if ( !context.preprocessing.community_detection.low_memory_contraction ) {
+            graph.allocateContractionBuffers();
+          }
+          timer.stop_timer("construct_graph");
+          timer.start_timer("perform_community_detection", "Perform Community Detection");
+          communities = community_detection::run_parallel_louvain(graph, context);
+          graph.restrictClusteringToHypernodes(hypergraph, communities);
+          timer.stop_timer("perform_community_detection");
+        }
+        if ( use_cache ) {
+          community_detection::writeCommunityCache(
+            context.partition.graph_community_cache_filename, cache_key, communities);
+        }
       }
-      timer.stop_timer("construct_graph");
-      timer.start_timer("perform_community_detection", "Perform Community Detection");
-      ds::Clustering communities = community_detection::run_parallel_louvain(graph, context);
-      graph.restrictClusteringToHypernodes(hypergraph, communities);
       hypergraph.setCommunityIDs(std::move(communities));
-      timer.stop_timer("perform_community_detection");
       timer.stop_timer("community_detection");
 
       if (context.partition.verbose_output) {
@@ -195,6 +249,31 @@ namespace mt_kahypar {
     parallel::MemoryPool::instance().release_mem_group("Preprocessing");
   }
 
+  // ! Contracts twin vertices and/or merges identical nets. The returned hypergraph
+  // ! contains vertex node_mapping[u] for each vertex u of the input hypergraph.
+  Hypergraph reduceHypergraph(const Hypergraph& hypergraph,
+                              const Context& context,
+                              vec<HypernodeID>& node_mapping) {
+    vec<HypernodeID> representatives;
+    if ( context.preprocessing.contract_twin_vertices ) {
+      representatives = reduction::computeTwinRepresentatives(
+        hypergraph, context.coarsening.max_allowed_node_weight);
+    } else {
+      representatives.resize(hypergraph.initialNumNodes());
+      std::iota(representatives.begin(), representatives.end(), ID(0));
+    }
+    Hypergraph reduced_hypergraph = reduction::reduceHypergraph(hypergraph, representatives,
+      context.preprocessing.merge_identical_nets,
+      context.preprocessing.stable_construction_of_incident_edges, node_mapping);
+
+    if ( context.partition.verbose_output ) {
+      LOG << "Contracted" << (hypergraph.initialNumNodes() - reduced_hypergraph.initialNumNodes())
+          << "twin vertices and removed" << (hypergraph.initialNumEdges() - reduced_hypergraph.initialNumEdges())
+          << "identical and single-pin nets";
+    }
+    return reduced_hypergraph;
+  }
+
   PartitionedHypergraph partition(Hypergraph& hypergraph, Context& context) {
     configurePreprocessing(hypergraph, context);
     setupContext(hypergraph, context);
@@ -206,21 +285,63 @@ namespace mt_kahypar {
     // ################## PREPROCESSING ##################
     utils::Timer& timer = utils::Utilities::instance().getTimer(context.utility_id);
     timer.start_timer("preprocessing", "Preprocessing");
-    preprocess(hypergraph, context);
+
+    // The partitioner works on a reduced copy of the hypergraph, if twin vertices are
+    // contracted or identical nets are merged. Twins are always assigned to the same block.
+    const bool reduce = context.preprocessing.contract_twin_vertices ||
+      context.preprocessing.merge_identical_nets;
+    Hypergraph reduced_hypergraph;
+    vec<HypernodeID> reduction_mapping;
+    if ( reduce ) {
+      timer.start_timer("hypergraph_reduction", "Hypergraph Reduction");
+      reduced_hypergraph = reduceHypergraph(hypergraph, context, reduction_mapping);
+      timer.stop_timer("hypergraph_reduction");
+    }
+    Hypergraph& reduced_input = reduce ? reduced_hypergraph : hypergraph;
+    preprocess(reduced_input, context);
+    if ( reduce ) {
+      // Communities are computed on the reduced hypergraph, but the interfaces
+      // expose the community IDs of the input hypergraph
+      hypergraph.doParallelForAllNodes([&](const HypernodeID hn) {
+        hypergraph.setCommunityID(hn, reduced_input.communityID(reduction_mapping[hn]));
+      });
+    }
+
+    // The partitioner works on a relabeled copy of the hypergraph, if a node ordering
+    // is specified. The partition is projected back onto the input hypergraph afterwards.
+    // Only the permutation is kept during partitioning. The input hypergraph is released
+    // and restored from the relabeled copy afterwards (a reduced hypergraph is not needed
+    // anymore, since the reduction mapping refers to the input hypergraph).
+    const bool reorder = context.preprocessing.node_ordering != NodeOrdering::none;
+    Hypergraph reordered_hypergraph;
+    vec<HypernodeID> node_mapping;
+    vec<HyperedgeID> original_edge_ids;
+    if ( reorder ) {
+      timer.start_timer("reordering", "Reordering");
+      node_mapping = reordering::computeNodeOrder(reduced_input, context.preprocessing.node_ordering);
+      reordered_hypergraph = reordering::reorderHypergraph(reduced_input, node_mapping,
+        context.preprocessing.stable_construction_of_incident_edges, original_edge_ids);
+      reduced_input = Hypergraph();
+      if ( reduce ) {
+        parallel::free(original_edge_ids);
+      }
+      timer.stop_timer("reordering");
+    }
+    Hypergraph& working_hypergraph = reorder ? reordered_hypergraph : reduced_input;
 
     DegreeZeroHypernodeRemover degree_zero_hn_remover(context);
     LargeHyperedgeRemover large_he_remover(context);
-    sanitize(hypergraph, context, degree_zero_hn_remover, large_he_remover);
+    sanitize(working_hypergraph, context, degree_zero_hn_remover, large_he_remover);
     timer.stop_timer("preprocessing");
 
     // ################## MULTILEVEL & VCYCLE ##################
     PartitionedHypergraph partitioned_hypergraph;
     if (context.partition.mode == Mode::direct) {
-      partitioned_hypergraph = multilevel::partition(hypergraph, context);
+      partitioned_hypergraph = multilevel::partition(working_hypergraph, context);
     } else if (context.partition.mode == Mode::recursive_bipartitioning) {
-      partitioned_hypergraph = recursive_bipartitioning::partition(hypergraph, context);
+      partitioned_hypergraph = recursive_bipartitioning::partition(working_hypergraph, context);
     } else if (context.partition.mode == Mode::deep_multilevel) {
-      partitioned_hypergraph = deep_multilevel::partition(hypergraph, context);
+      partitioned_hypergraph = deep_multilevel::partition(working_hypergraph, context);
     } else {
       ERROR("Invalid mode: " << context.partition.mode);
     }
@@ -229,6 +350,23 @@ namespace mt_kahypar {
     timer.start_timer("postprocessing", "Postprocessing");
     large_he_remover.restoreLargeHyperedges(partitioned_hypergraph);
     degree_zero_hn_remover.restoreDegreeZeroHypernodes(partitioned_hypergraph);
+    if ( reorder && !reduce ) {
+      timer.start_timer("restore_input", "Restore Input Hypergraph");
+      hypergraph = reordering::restoreHypergraph(working_hypergraph, node_mapping,
+        original_edge_ids, context.preprocessing.stable_construction_of_incident_edges);
+      timer.stop_timer("restore_input");
+    }
+    if ( reduce || reorder ) {
+      PartitionedHypergraph input_partitioned_hypergraph(
+        context.partition.k, hypergraph, parallel_tag_t());
+      hypergraph.doParallelForAllNodes([&](const HypernodeID hn) {
+        const HypernodeID reduced_hn = reduce ? reduction_mapping[hn] : hn;
+        input_partitioned_hypergraph.setOnlyNodePart(hn, partitioned_hypergraph.partID(
+          reorder ? node_mapping[reduced_hn] : reduced_hn));
+      });
+      input_partitioned_hypergraph.initializePartition();
+      partitioned_hypergraph = std::move(input_partitioned_hypergraph);
+    }
     timer.stop_timer("postprocessing");
 
     if (context.partition.verbose_output) {
@@ -279,6 +417,85 @@ namespace mt_kahypar {
     }
   }
 
+  vec<vec<PartitionID>> partitionForMultipleK(Hypergraph& hypergraph, vec<Context>& contexts) {
+    ASSERT(!contexts.empty());
+    for ( Context& context : contexts ) {
+      configurePreprocessing(hypergraph, context);
+      setupContext(hypergraph, context);
+      if ( context.partition.mode != Mode::direct ||
+           context.partition.paradigm != Paradigm::multilevel ||
+           context.partition.num_vcycles > 0 ||
+           context.useSparsification() ) {
+        ERROR("Reusing the coarsening hierarchy is only supported for multilevel direct "
+          << "k-way partitioning without v-cycles and sparsification");
+      }
+    }
+
+    // The hierarchy is built with the smallest contraction limit and reused
+    // for all other contexts in increasing order of their contraction limits
+    vec<size_t> order(contexts.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](const size_t lhs, const size_t rhs) {
+      return contexts[lhs].coarsening.contraction_limit < contexts[rhs].coarsening.contraction_limit;
+    });
+    vec<Context> sorted_contexts;
+    for ( const size_t i : order ) {
+      sorted_contexts.push_back(contexts[i]);
+    }
+    Context& coarsening_context = sorted_contexts[0];
+
+    io::printContext(coarsening_context);
+    io::printMemoryPoolConsumption(coarsening_context);
+    io::printInputInformation(coarsening_context, hypergraph);
+
+    // ################## PREPROCESSING ##################
+    utils::Timer& timer = utils::Utilities::instance().getTimer(coarsening_context.utility_id);
+    timer.start_timer("preprocessing", "Preprocessing");
+    preprocess(hypergraph, coarsening_context);
+
+    DegreeZeroHypernodeRemover degree_zero_hn_remover(coarsening_context);
+    LargeHyperedgeRemover large_he_remover(coarsening_context);
+    sanitize(hypergraph, coarsening_context, degree_zero_hn_remover, large_he_remover);
+    timer.stop_timer("preprocessing");
+
+    // ################## MULTILEVEL ##################
+    // A coarse vertex must not be heavier than the maximum allowed node weight of
+    // any context (otherwise, a balanced partition may not exist for larger k).
+    // Therefore, the hierarchy is built with the tightest bound of all contexts,
+    // which is also used to cap the adaptive increase of the node weight bound.
+    Context multilevel_context(coarsening_context);
+    HypernodeWeight max_part_weight = std::numeric_limits<HypernodeWeight>::max();
+    for ( const Context& context : sorted_contexts ) {
+      multilevel_context.coarsening.max_allowed_node_weight = std::min(
+        multilevel_context.coarsening.max_allowed_node_weight, context.coarsening.max_allowed_node_weight);
+      max_part_weight = std::min(max_part_weight, *std::max_element(
+        context.partition.max_part_weights.cbegin(), context.partition.max_part_weights.cend()));
+    }
+    multilevel_context.partition.max_part_weights.assign(multilevel_context.partition.k, max_part_weight);
+
+    vec<vec<PartitionID>> partitions(contexts.size());
+    multilevel::partitionForMultipleK(hypergraph, multilevel_context, sorted_contexts,
+      [&](const size_t i, PartitionedHypergraph& partitioned_hypergraph) {
+        // The sanitized hypergraph is shared by all runs. Therefore, the blocks of
+        // degree-zero vertices are only computed, but the vertices are not restored.
+        vec<PartitionID>& partition = partitions[order[i]];
+        partition.assign(hypergraph.initialNumNodes(), kInvalidPartition);
+        partitioned_hypergraph.doParallelForAllNodes([&](const HypernodeID hn) {
+          partition[hn] = partitioned_hypergraph.partID(hn);
+        });
+        degree_zero_hn_remover.assignDegreeZeroHypernodes(
+          partitioned_hypergraph, sorted_contexts[i], partition);
+      });
+
+    // ################## POSTPROCESSING ##################
+    timer.start_timer("postprocessing", "Postprocessing");
+    large_he_remover.restoreLargeHyperedges(hypergraph);
+    degree_zero_hn_remover.restoreDegreeZeroHypernodes(hypergraph);
+    timer.stop_timer("postprocessing");
+
+    return partitions;
+  }
+
 
 
 }
\ No newline at end of file
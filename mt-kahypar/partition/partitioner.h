@@ -31,6 +31,21 @@
 #include "mt-kahypar/partition/context.h"
 
 namespace mt_kahypar {
+  // ! Partitions the hypergraph. The returned partitioned hypergraph refers to the input
+  // ! hypergraph. If a node ordering is specified (and no twin vertices or identical nets
+  // ! are contracted), the input hypergraph is released while its relabeled copy is
+  // ! partitioned and is rebuilt afterwards: the caller's object is replaced by a new
+  // ! hypergraph with the same vertex and net IDs, weights, pin order and community IDs,
+  // ! but all references into its internal data are invalidated.
   PartitionedHypergraph partition(Hypergraph& hypergraph, Context& context);
   void partitionVCycle(PartitionedHypergraph& partitioned_hg, Context& context);
+  // ! Detects the communities of the hypergraph (or reads them from the community
+  // ! cache) and stores them in the hypergraph
+  void preprocess(Hypergraph& hypergraph, Context& context);
+  // ! Partitions the hypergraph for several contexts that only differ in the number
+  // ! of blocks (or imbalance) and returns the block IDs of each partition. Preprocessing
+  // ! and coarsening are performed only once and the multilevel hierarchy is shared
+  // ! by all partitioning runs. Only multilevel direct k-way partitioning without
+  // ! v-cycles and sparsification is supported.
+  vec<vec<PartitionID>> partitionForMultipleK(Hypergraph& hypergraph, vec<Context>& contexts);
 }  // namespace mt_kahypar
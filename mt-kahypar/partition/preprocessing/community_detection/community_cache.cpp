@@ -0,0 +1,161 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2021 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+
+#include "community_cache.h"
+
+#include <cstdio>
+#include <fstream>
+
+#include <unistd.h>
+
+#include "tbb/parallel_reduce.h"
+
+#include "mt-kahypar/macros.h"
+
+namespace mt_kahypar::community_detection {
+
+  namespace {
+    static constexpr uint64_t kMagicNumber = 0x4d544b48434f4d31; // "MTKHCOM1"
+
+    struct CacheFileHeader {
+      uint64_t magic_number;
+      uint64_t input_checksum;
+      uint64_t settings_checksum;
+      uint64_t num_nodes;
+    };
+
+    // splitmix64 finalizer
+    uint64_t mix(uint64_t x) {
+      x += 0x9e3779b97f4a7c15;
+      x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9;
+      x = (x ^ (x >> 27)) * 0x94d049bb133111eb;
+      return x ^ (x >> 31);
+    }
+
+    uint64_t combine(const uint64_t seed, const uint64_t value) {
+      return mix(seed ^ mix(value));
+    }
+  }
+
+  CommunityCacheKey computeCommunityCacheKey(const Hypergraph& hypergraph, const Context& context) {
+    // The checksum is a sum of per-node and per-edge hashes (and the hash of an edge is
+    // independent of the order of its pins). Thus, it does not depend on the order
+    // in which the hypergraph was constructed.
+    const uint64_t node_checksum = tbb::parallel_reduce(
+      tbb::blocked_range<HypernodeID>(ID(0), hypergraph.initialNumNodes()), uint64_t(0),
+      [&](const tbb::blocked_range<HypernodeID>& range, uint64_t checksum) {
+        for ( HypernodeID hn = range.begin(); hn < range.end(); ++hn ) {
+          checksum += combine(hn, hypergraph.nodeWeight(hn));
+        }
+        return checksum;
+      }, std::plus<uint64_t>());
+    const uint64_t edge_checksum = tbb::parallel_reduce(
+      tbb::blocked_range<HyperedgeID>(ID(0), hypergraph.initialNumEdges()), uint64_t(0),
+      [&](const tbb::blocked_range<HyperedgeID>& range, uint64_t checksum) {
+        for ( HyperedgeID he = range.begin(); he < range.end(); ++he ) {
+          uint64_t pin_checksum = 0;
+          for ( const HypernodeID& pin : hypergraph.pins(he) ) {
+            pin_checksum += mix(pin);
+          }
+          checksum += combine(pin_checksum, hypergraph.edgeWeight(he));
+        }
+        return checksum;
+      }, std::plus<uint64_t>());
+
+    CommunityCacheKey key;
+    key.num_nodes = hypergraph.initialNumNodes();
+    key.input_checksum = combine(combine(combine(combine(0,
+      hypergraph.initialNumNodes()), hypergraph.initialNumEdges()), node_checksum), edge_checksum);
+
+    const CommunityDetectionParameters& params = context.preprocessing.community_detection;
+    uint64_t settings_checksum = 0;
+    settings_checksum = combine(settings_checksum, static_cast<uint64_t>(params.edge_weight_function));
+    settings_checksum = combine(settings_checksum, params.max_pass_iterations);
+    settings_checksum = combine(settings_checksum, static_cast<uint64_t>(params.min_vertex_move_fraction * 1e9L));
+    settings_checksum = combine(settings_checksum, params.vertex_degree_sampling_threshold);
+    // The implicit star expansion visits the arcs of a node in a different order than
+    // the explicitly constructed graph, which can result in different communities
+    settings_checksum = combine(settings_checksum, params.implicit_star_expansion);
+    settings_checksum = combine(settings_checksum, context.partition.deterministic);
+    // Only the deterministic mode reproduces the same communities for the same seed, but
+    // the seed also determines the random node order of the non-deterministic mode. A run
+    // with a different seed should not reuse the communities of another seed.
+    settings_checksum = combine(settings_checksum, context.partition.seed);
+    if ( context.partition.deterministic ) {
+      settings_checksum = combine(settings_checksum, params.num_sub_rounds_deterministic);
+    }
+    key.settings_checksum = settings_checksum;
+    return key;
+  }
+
+  bool readCommunityCache(const std::string& filename,
+                          const CommunityCacheKey& key,
+                          ds::Clustering& communities) {
+    std::ifstream file(filename, std::ios::binary);
+    if ( !file ) {
+      return false;
+    }
+    CacheFileHeader header;
+    file.read(reinterpret_cast<char*>(&header), sizeof(CacheFileHeader));
+    if ( !file || header.magic_number != kMagicNumber ||
+         header.input_checksum != key.input_checksum ||
+         header.settings_checksum != key.settings_checksum ||
+         header.num_nodes != key.num_nodes ) {
+      return false;
+    }
+    communities.resize(key.num_nodes);
+    file.read(reinterpret_cast<char*>(communities.data()), sizeof(PartitionID) * key.num_nodes);
+    if ( !file ) {
+      communities.clear();
+      return false;
+    }
+    return true;
+  }
+
+  void writeCommunityCache(const std::string& filename,
+                           const CommunityCacheKey& key,
+                           const ds::Clustering& communities) {
+    ASSERT(communities.size() == key.num_nodes);
+    // Concurrent runs on the same input should never read a partially written
+    // file. Therefore, we write to a temporary file and rename it afterwards.
+    const std::string tmp_filename = filename + ".tmp" + std::to_string(::getpid());
+    std::ofstream file(tmp_filename, std::ios::binary);
+    if ( !file ) {
+      WARNING("Could not write community cache file" << filename);
+      return;
+    }
+    const CacheFileHeader header { kMagicNumber, key.input_checksum,
+      key.settings_checksum, static_cast<uint64_t>(key.num_nodes) };
+    file.write(reinterpret_cast<const char*>(&header), sizeof(CacheFileHeader));
+    file.write(reinterpret_cast<const char*>(communities.data()), sizeof(PartitionID) * communities.size());
+    file.close();
+    if ( !file || std::rename(tmp_filename.c_str(), filename.c_str()) != 0 ) {
+      WARNING("Could not write community cache file" << filename);
+      std::remove(tmp_filename.c_str());
+    }
+  }
+}  // namespace mt_kahypar::community_detection
@@ -0,0 +1,59 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2021 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+
+#pragma once
+
+#include <string>
+
+#include "mt-kahypar/definitions.h"
+#include "mt-kahypar/partition/context.h"
+
+namespace mt_kahypar::community_detection {
+  // ! Identifies a community detection result. The cached communities
+  // ! can only be reused if both checksums match.
+  struct CommunityCacheKey {
+    // ! Checksum of the node weights, edge weights and pins of the input
+    uint64_t input_checksum;
+    // ! Checksum of all parameters that influence the community detection
+    uint64_t settings_checksum;
+    HypernodeID num_nodes;
+  };
+
+  CommunityCacheKey computeCommunityCacheKey(const Hypergraph& hypergraph, const Context& context);
+
+  // ! Reads the community IDs from a cache file written by writeCommunityCache(...).
+  // ! Returns false, if the file does not exist or was written for a different
+  // ! input or different community detection parameters.
+  bool readCommunityCache(const std::string& filename,
+                          const CommunityCacheKey& key,
+                          ds::Clustering& communities);
+
+  // ! Writes the community IDs together with the key into a binary cache file
+  void writeCommunityCache(const std::string& filename,
+                           const CommunityCacheKey& key,
+                           const ds::Clustering& communities);
+}  // namespace mt_kahypar::community_detection
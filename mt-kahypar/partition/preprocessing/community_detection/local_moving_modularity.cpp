@@ -27,6 +27,7 @@
 
 #include "local_moving_modularity.h"
 
+#include "mt-kahypar/datastructures/star_expansion_graph.h"
 #include "mt-kahypar/utils/timer.h"
 #include "mt-kahypar/utils/floating_point_comparisons.h"
 #include "mt-kahypar/parallel/stl/thread_locals.h"
@@ -35,7 +36,8 @@
 #include <tbb/parallel_sort.h>
 
 namespace mt_kahypar::metrics {
-double modularity(const Graph& graph, const ds::Clustering& communities) {
+template<typename GraphT>
+double modularity(const GraphT& graph, const ds::Clustering& communities) {
   ASSERT(graph.canBeUsed());
   ASSERT(graph.numNodes() == communities.size());
   vec<NodeID> nodes(graph.numNodes());
@@ -75,11 +77,15 @@ double modularity(const Graph& graph, const ds::Clustering& communities) {
   };
   return tbb::parallel_deterministic_reduce(r, 0.0, combine_range, std::plus<>()) / graph.totalVolume();
 }
+
+template double modularity(const Graph& graph, const ds::Clustering& communities);
+template double modularity(const StarExpansionGraph& graph, const ds::Clustering& communities);
 }
 
 namespace mt_kahypar::community_detection {
 
-bool ParallelLocalMovingModularity::localMoving(Graph& graph, ds::Clustering& communities) {
+template<typename GraphT>
+bool ParallelLocalMovingModularity::localMoving(const GraphT& graph, ds::Clustering& communities) {
   ASSERT(graph.canBeUsed());
   _max_degree = graph.max_degree();
   _reciprocal_total_volume = 1.0 / graph.totalVolume();
@@ -122,7 +128,8 @@ bool ParallelLocalMovingModularity::localMoving(Graph& graph, ds::Clustering& co
   return clustering_changed;
 }
 
-size_t ParallelLocalMovingModularity::synchronousParallelRound(const Graph& graph, ds::Clustering& communities) {
+template<typename GraphT>
+size_t ParallelLocalMovingModularity::synchronousParallelRound(const GraphT& graph, ds::Clustering& communities) {
   if (graph.numNodes() < 200) {
     return sequentialRound(graph, communities);
   }
@@ -204,7 +211,8 @@ size_t ParallelLocalMovingModularity::synchronousParallelRound(const Graph& grap
   return num_moved_nodes;
 }
 
-size_t ParallelLocalMovingModularity::sequentialRound(const Graph& graph, ds::Clustering& communities) {
+template<typename GraphT>
+size_t ParallelLocalMovingModularity::sequentialRound(const GraphT& graph, ds::Clustering& communities) {
   size_t seed = prng();
   permutation.sequential_fallback(graph.numNodes(), seed);
   size_t num_moved = 0;
@@ -221,7 +229,8 @@ size_t ParallelLocalMovingModularity::sequentialRound(const Graph& graph, ds::Cl
   return num_moved;
 }
 
-size_t ParallelLocalMovingModularity::parallelNonDeterministicRound(const Graph& graph, ds::Clustering& communities) {
+template<typename GraphT>
+size_t ParallelLocalMovingModularity::parallelNonDeterministicRound(const GraphT& graph, ds::Clustering& communities) {
   auto& nodes = permutation.permutation;
   if ( !_disable_randomization ) {
     utils::Randomize::instance().parallelShuffleVector(nodes, 0UL, nodes.size());
@@ -250,7 +259,8 @@ size_t ParallelLocalMovingModularity::parallelNonDeterministicRound(const Graph&
 }
 
 
-bool ParallelLocalMovingModularity::verifyGain(const Graph& graph, const ds::Clustering& communities, const NodeID u,
+template<typename GraphT>
+bool ParallelLocalMovingModularity::verifyGain(const GraphT& graph, const ds::Clustering& communities, const NodeID u,
                                                const PartitionID to, double gain, double weight_from, double weight_to) {
   if (_context.partition.deterministic) {
     // the check is omitted, since changing the cluster volumes breaks determinism
@@ -302,8 +312,9 @@ bool ParallelLocalMovingModularity::verifyGain(const Graph& graph, const ds::Clu
   return result;
 }
 
+template<typename GraphT>
 std::pair<ArcWeight, ArcWeight> ParallelLocalMovingModularity::intraClusterWeightsAndSumOfSquaredClusterVolumes(
-        const Graph& graph, const ds::Clustering& communities) {
+        const GraphT& graph, const ds::Clustering& communities) {
   ArcWeight intraClusterWeights = 0;
   ArcWeight sumOfSquaredClusterVolumes = 0;
   vec<ArcWeight> cluster_volumes(graph.numNodes(), 0);
@@ -328,7 +339,8 @@ std::pair<ArcWeight, ArcWeight> ParallelLocalMovingModularity::intraClusterWeigh
   return std::make_pair(intraClusterWeights, sumOfSquaredClusterVolumes);
 }
 
-void ParallelLocalMovingModularity::initializeClusterVolumes(const Graph& graph, ds::Clustering& communities) {
+template<typename GraphT>
+void ParallelLocalMovingModularity::initializeClusterVolumes(const GraphT& graph, ds::Clustering& communities) {
   _reciprocal_total_volume = 1.0 / graph.totalVolume();
   _vol_multiplier_div_by_node_vol =  _reciprocal_total_volume;
   tbb::parallel_for(0U, static_cast<NodeID>(graph.numNodes()), [&](const NodeID u) {
@@ -337,6 +349,15 @@ void ParallelLocalMovingModularity::initializeClusterVolumes(const Graph& graph,
   });
 }
 
+template bool ParallelLocalMovingModularity::localMoving(const Graph& graph, ds::Clustering& communities);
+template bool ParallelLocalMovingModularity::localMoving(const StarExpansionGraph& graph, ds::Clustering& communities);
+template void ParallelLocalMovingModularity::initializeClusterVolumes(const Graph& graph, ds::Clustering& communities);
+template void ParallelLocalMovingModularity::initializeClusterVolumes(const StarExpansionGraph& graph, ds::Clustering& communities);
+template bool ParallelLocalMovingModularity::verifyGain(const Graph& graph, const ds::Clustering& communities, NodeID u,
+                                                        PartitionID to, double gain, double weight_from, double weight_to);
+template bool ParallelLocalMovingModularity::verifyGain(const StarExpansionGraph& graph, const ds::Clustering& communities, NodeID u,
+                                                        PartitionID to, double gain, double weight_from, double weight_to);
+
 ParallelLocalMovingModularity::~ParallelLocalMovingModularity() {
 /*
   tbb::parallel_invoke([&] {
@@ -43,7 +43,8 @@
 #include "gtest/gtest_prod.h"
 
 namespace mt_kahypar::metrics {
-  double modularity(const Graph& graph, const ds::Clustering& communities);
+  template<typename GraphT>
+  double modularity(const GraphT& graph, const ds::Clustering& communities);
 }
 
 namespace mt_kahypar::community_detection {
@@ -74,12 +75,17 @@ class ParallelLocalMovingModularity {
 
   ~ParallelLocalMovingModularity();
 
-  bool localMoving(Graph& graph, ds::Clustering& communities);
+  // ! Works on the Graph as well as on the implicit StarExpansionGraph
+  template<typename GraphT>
+  bool localMoving(const GraphT& graph, ds::Clustering& communities);
 
  private:
-  size_t parallelNonDeterministicRound(const Graph& graph, ds::Clustering& communities);
-  size_t synchronousParallelRound(const Graph& graph, ds::Clustering& communities);
-  size_t sequentialRound(const Graph& graph, ds::Clustering& communities);
+  template<typename GraphT>
+  size_t parallelNonDeterministicRound(const GraphT& graph, ds::Clustering& communities);
+  template<typename GraphT>
+  size_t synchronousParallelRound(const GraphT& graph, ds::Clustering& communities);
+  template<typename GraphT>
+  size_t sequentialRound(const GraphT& graph, ds::Clustering& communities);
 
   struct ClearList {
     vec<double> weights;
@@ -88,7 +94,8 @@ class ParallelLocalMovingModularity {
   };
 
 
-  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE bool ratingsFitIntoSmallSparseMap(const Graph& graph,
+  template<typename GraphT>
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE bool ratingsFitIntoSmallSparseMap(const GraphT& graph,
                                                                        const HypernodeID u)  {
     static constexpr size_t cache_efficient_map_size = CacheEfficientIncidentClusterWeights::MAP_SIZE / 3UL;
     return std::min(_vertex_degree_sampling_threshold, _max_degree) > cache_efficient_map_size &&
@@ -100,15 +107,18 @@ class ParallelLocalMovingModularity {
   }
 
   // ! Only for testing
-  void initializeClusterVolumes(const Graph& graph, ds::Clustering& communities);
+  template<typename GraphT>
+  void initializeClusterVolumes(const GraphT& graph, ds::Clustering& communities);
 
-  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE PartitionID computeMaxGainCluster(const Graph& graph,
+  template<typename GraphT>
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE PartitionID computeMaxGainCluster(const GraphT& graph,
                                                                        const ds::Clustering& communities,
                                                                        const NodeID u) {
     return computeMaxGainCluster(graph, communities, u, non_sampling_incident_cluster_weights.local());
   }
 
-  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE PartitionID computeMaxGainCluster(const Graph& graph,
+  template<typename GraphT>
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE PartitionID computeMaxGainCluster(const GraphT& graph,
                                                                        const ds::Clustering& communities,
                                                                        const NodeID u,
                                                                        ClearList& incident_cluster_weights) {
@@ -172,10 +182,12 @@ class ParallelLocalMovingModularity {
   }
 
 
-  bool verifyGain(const Graph& graph, const ds::Clustering& communities, NodeID u, PartitionID to, double gain,
+  template<typename GraphT>
+  bool verifyGain(const GraphT& graph, const ds::Clustering& communities, NodeID u, PartitionID to, double gain,
                   double weight_from, double weight_to);
 
-  static std::pair<ArcWeight, ArcWeight> intraClusterWeightsAndSumOfSquaredClusterVolumes(const Graph& graph, const ds::Clustering& communities);
+  template<typename GraphT>
+  static std::pair<ArcWeight, ArcWeight> intraClusterWeightsAndSumOfSquaredClusterVolumes(const GraphT& graph, const ds::Clustering& communities);
 
   const Context& _context;
   size_t _max_degree;
@@ -66,4 +66,37 @@ namespace mt_kahypar::community_detection {
     ds::Clustering communities = local_moving_contract_recurse(graph, mlv, context);
     return communities;
   }
+
+  ds::Clustering run_parallel_louvain(const StarExpansionGraph& graph, const Context& context, bool disable_randomization) {
+    utils::Timer& timer = utils::Utilities::instance().getTimer(context.utility_id);
+    ParallelLocalMovingModularity mlv(context, graph.numNodes(), disable_randomization);
+    timer.start_timer("local_moving", "Local Moving");
+    ds::Clustering communities(graph.numNodes());
+    bool communities_changed = mlv.localMoving(graph, communities);
+    timer.stop_timer("local_moving");
+
+    if (communities_changed) {
+      timer.start_timer("contraction", "Contraction");
+      // Materialize the contracted star expansion
+      Graph coarse_graph = graph.contract(communities);
+      ASSERT(coarse_graph.totalVolume() == graph.totalVolume());
+      if ( !context.preprocessing.community_detection.low_memory_contraction ) {
+        coarse_graph.allocateContractionBuffers();
+      }
+      timer.stop_timer("contraction");
+
+      // Recurse on contracted graph
+      ds::Clustering coarse_communities = local_moving_contract_recurse(coarse_graph, mlv, context);
+
+      timer.start_timer("project", "Project");
+      // Prolong Clustering
+      tbb::parallel_for(0UL, graph.numNodes(), [&](const NodeID u) {
+        ASSERT(communities[u] < static_cast<PartitionID>(coarse_communities.size()));
+        communities[u] = coarse_communities[communities[u]];
+      });
+      timer.stop_timer("project");
+    }
+
+    return communities;
+  }
 }
\ No newline at end of file
@@ -29,8 +29,12 @@
 #pragma once
 
 #include "mt-kahypar/partition/preprocessing/community_detection/local_moving_modularity.h"
+#include "mt-kahypar/datastructures/star_expansion_graph.h"
 
 namespace mt_kahypar::community_detection {
   ds::Clustering local_moving_contract_recurse(Graph& fine_graph, ParallelLocalMovingModularity& mlv, const Context& context);
   ds::Clustering run_parallel_louvain(Graph& graph, const Context& context, bool disable_randomization = false);
+  // ! Runs the first level of the Louvain method on the implicit star expansion.
+  // ! A graph is only materialized when the first level is contracted.
+  ds::Clustering run_parallel_louvain(const StarExpansionGraph& graph, const Context& context, bool disable_randomization = false);
 }
@@ -0,0 +1,266 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2021 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include "hypergraph_reduction.h"
+
+#include <tuple>
+
+#include "tbb/enumerable_thread_specific.h"
+#include "tbb/parallel_for.h"
+#include "tbb/parallel_invoke.h"
+#include "tbb/parallel_sort.h"
+
+#include "mt-kahypar/parallel/parallel_prefix_sum.h"
+
+namespace mt_kahypar::reduction {
+
+  namespace {
+    // ! Footprint and size of a set and the ID of the element it belongs to
+    // ! (a vertex for its incident nets, a net for its pins)
+    template<typename IDType>
+    using SetKey = std::tuple<size_t, size_t, IDType>;
+
+    // ! Order-independent footprint of a set (same as for parallel nets in contractions)
+    template<typename Range>
+    size_t footprint(Range&& range) {
+      size_t hash = kEdgeHashSeed;
+      for ( const auto& element : range ) {
+        hash += static_cast<size_t>(element) * static_cast<size_t>(element);
+      }
+      return hash;
+    }
+
+    // ! Calls f for each group of at least two elements with identical sets. Elements
+    // ! with the same footprint and size are compared explicitly (set_of(id) must return
+    // ! the sorted set of id). The IDs passed to f are in increasing order.
+    template<typename IDType, typename SetFunc, typename F>
+    void forEachGroupOfIdenticalSets(vec<SetKey<IDType>>& keys, const SetFunc& set_of, const F& f) {
+      tbb::parallel_sort(keys.begin(), keys.end());
+      vec<size_t> group_starts;
+      for ( size_t i = 0; i < keys.size(); ++i ) {
+        if ( i == 0 || std::get<0>(keys[i]) != std::get<0>(keys[i - 1]) ||
+             std::get<1>(keys[i]) != std::get<1>(keys[i - 1]) ) {
+          group_starts.push_back(i);
+        }
+      }
+      group_starts.push_back(keys.size());
+
+      tbb::parallel_for(0UL, group_starts.size() - 1, [&](const size_t group) {
+        const size_t begin = group_starts[group];
+        const size_t end = group_starts[group + 1];
+        if ( end - begin < 2 ) {
+          return;
+        }
+        using Set = decltype(set_of(IDType()));
+        vec<std::pair<Set, IDType>> sets;
+        for ( size_t i = begin; i < end; ++i ) {
+          const IDType id = std::get<2>(keys[i]);
+          sets.emplace_back(set_of(id), id);
+        }
+        std::sort(sets.begin(), sets.end());
+        vec<IDType> identical;
+        for ( size_t i = 0; i < sets.size(); ) {
+          identical.clear();
+          size_t j = i;
+          for ( ; j < sets.size() && sets[j].first == sets[i].first; ++j ) {
+            identical.push_back(sets[j].second);
+          }
+          if ( identical.size() > 1 ) {
+            f(identical);
+          }
+          i = j;
+        }
+      });
+    }
+
+    template<typename IDType>
+    vec<SetKey<IDType>> combine(tbb::enumerable_thread_specific<vec<SetKey<IDType>>>& local_keys) {
+      vec<SetKey<IDType>> keys;
+      for ( const vec<SetKey<IDType>>& local : local_keys ) {
+        keys.insert(keys.end(), local.begin(), local.end());
+      }
+      return keys;
+    }
+
+    // ! For graphs, each undirected edge is represented by two directed
+    // ! edges of which only one is used to construct the reduced graph
+    bool isRepresentativeEdge(const Hypergraph& hypergraph, const HyperedgeID he) {
+      if constexpr ( Hypergraph::is_graph ) {
+        auto pins = hypergraph.pins(he);
+        auto it = pins.begin();
+        const HypernodeID source = *it;
+        const HypernodeID target = *(++it);
+        return source < target;
+      } else {
+        unused(hypergraph);
+        unused(he);
+        return true;
+      }
+    }
+  } // namespace
+
+  vec<HypernodeID> computeTwinRepresentatives(const Hypergraph& hypergraph,
+                                              const HypernodeWeight max_node_weight) {
+    ASSERT(hypergraph.numRemovedHypernodes() == 0);
+    const HypernodeID num_nodes = hypergraph.initialNumNodes();
+    vec<HypernodeID> representatives(num_nodes);
+    tbb::enumerable_thread_specific<vec<SetKey<HypernodeID>>> local_keys;
+    hypergraph.doParallelForAllNodes([&](const HypernodeID hn) {
+      representatives[hn] = hn;
+      if ( hypergraph.nodeDegree(hn) > 0 && hypergraph.nodeWeight(hn) < max_node_weight ) {
+        local_keys.local().emplace_back(footprint(hypergraph.incidentEdges(hn)),
+          hypergraph.nodeDegree(hn), hn);
+      }
+    });
+    vec<SetKey<HypernodeID>> keys = combine(local_keys);
+
+    forEachGroupOfIdenticalSets(keys, [&](const HypernodeID hn) {
+      vec<HyperedgeID> nets;
+      for ( const HyperedgeID& he : hypergraph.incidentEdges(hn) ) {
+        nets.push_back(he);
+      }
+      std::sort(nets.begin(), nets.end());
+      return nets;
+    }, [&](const vec<HypernodeID>& twins) {
+      // Twins are contracted into their smallest vertex until the weight limit is reached
+      HypernodeID representative = twins[0];
+      HypernodeWeight weight = hypergraph.nodeWeight(representative);
+      for ( size_t i = 1; i < twins.size(); ++i ) {
+        const HypernodeID hn = twins[i];
+        if ( weight + hypergraph.nodeWeight(hn) <= max_node_weight ) {
+          representatives[hn] = representative;
+          weight += hypergraph.nodeWeight(hn);
+        } else {
+          representative = hn;
+          weight = hypergraph.nodeWeight(hn);
+        }
+      }
+    });
+    return representatives;
+  }
+
+  Hypergraph reduceHypergraph(const Hypergraph& hypergraph,
+                              const vec<HypernodeID>& representatives,
+                              const bool merge_identical_nets,
+                              const bool stable_construction_of_incident_edges,
+                              vec<HypernodeID>& node_mapping) {
+    ASSERT(hypergraph.numRemovedHypernodes() == 0);
+    ASSERT(representatives.size() == hypergraph.initialNumNodes());
+    const HypernodeID num_nodes = hypergraph.initialNumNodes();
+    const HyperedgeID num_edges = hypergraph.initialNumEdges();
+
+    // Representatives are relabeled consecutively in increasing order of their IDs
+    vec<HypernodeID> reduced_ids(num_nodes + 1, 0);
+    tbb::parallel_for(ID(0), num_nodes, [&](const HypernodeID hn) {
+      reduced_ids[hn + 1] = representatives[hn] == hn ? 1 : 0;
+    });
+    parallel_prefix_sum(reduced_ids.begin(), reduced_ids.end(), reduced_ids.begin(),
+      std::plus<HypernodeID>(), ID(0));
+    const HypernodeID num_reduced_nodes = reduced_ids[num_nodes];
+    node_mapping.resize(num_nodes);
+    tbb::parallel_for(ID(0), num_nodes, [&](const HypernodeID hn) {
+      ASSERT(representatives[representatives[hn]] == representatives[hn]);
+      node_mapping[hn] = reduced_ids[representatives[hn]];
+    });
+
+    // Contract the pins of each net and remove single-pin nets
+    parallel::scalable_vector<parallel::scalable_vector<HypernodeID>> pins(num_edges);
+    vec<HyperedgeWeight> net_weights(num_edges, 0);
+    vec<uint8_t> is_removed(num_edges, true);
+    tbb::enumerable_thread_specific<vec<SetKey<HyperedgeID>>> local_keys;
+    hypergraph.doParallelForAllEdges([&](const HyperedgeID he) {
+      if ( isRepresentativeEdge(hypergraph, he) ) {
+        parallel::scalable_vector<HypernodeID>& contracted_pins = pins[he];
+        for ( const HypernodeID& pin : hypergraph.pins(he) ) {
+          contracted_pins.push_back(node_mapping[pin]);
+        }
+        std::sort(contracted_pins.begin(), contracted_pins.end());
+        contracted_pins.erase(std::unique(contracted_pins.begin(), contracted_pins.end()), contracted_pins.end());
+        if ( contracted_pins.size() > 1 ) {
+          is_removed[he] = false;
+          net_weights[he] = hypergraph.edgeWeight(he);
+          local_keys.local().emplace_back(footprint(contracted_pins), contracted_pins.size(), he);
+        } else {
+          parallel::free(contracted_pins);
+        }
+      }
+    });
+    vec<SetKey<HyperedgeID>> keys = combine(local_keys);
+
+    // Identical nets are merged into the net with the smallest ID
+    if ( merge_identical_nets ) {
+      forEachGroupOfIdenticalSets(keys, [&](const HyperedgeID he) {
+        return pins[he];
+      }, [&](const vec<HyperedgeID>& identical_nets) {
+        const HyperedgeID representative = identical_nets[0];
+        for ( size_t i = 1; i < identical_nets.size(); ++i ) {
+          const HyperedgeID he = identical_nets[i];
+          net_weights[representative] += net_weights[he];
+          is_removed[he] = true;
+        }
+      });
+    }
+
+    vec<HyperedgeID> nets;
+    for ( const SetKey<HyperedgeID>& key : keys ) {
+      if ( !is_removed[std::get<2>(key)] ) {
+        nets.push_back(std::get<2>(key));
+      }
+    }
+    tbb::parallel_sort(nets.begin(), nets.end());
+    const HyperedgeID num_reduced_nets = nets.size();
+
+    parallel::scalable_vector<parallel::scalable_vector<HypernodeID>> edge_vector(num_reduced_nets);
+    vec<HyperedgeWeight> edge_weights(num_reduced_nets);
+    vec<CAtomic<HypernodeWeight>> node_weights(num_reduced_nodes, CAtomic<HypernodeWeight>(0));
+    ds::Clustering community_ids(num_reduced_nodes);
+    tbb::parallel_invoke([&] {
+      tbb::parallel_for(ID(0), num_reduced_nets, [&](const HyperedgeID pos) {
+        const HyperedgeID he = nets[pos];
+        edge_vector[pos] = std::move(pins[he]);
+        edge_weights[pos] = net_weights[he];
+      });
+    }, [&] {
+      tbb::parallel_for(ID(0), num_nodes, [&](const HypernodeID hn) {
+        node_weights[node_mapping[hn]].fetch_add(hypergraph.nodeWeight(hn), std::memory_order_relaxed);
+        if ( representatives[hn] == hn ) {
+          community_ids[node_mapping[hn]] = hypergraph.communityID(hn);
+        }
+      });
+    });
+    vec<HypernodeWeight> reduced_node_weights(num_reduced_nodes);
+    tbb::parallel_for(ID(0), num_reduced_nodes, [&](const HypernodeID hn) {
+      reduced_node_weights[hn] = node_weights[hn].load(std::memory_order_relaxed);
+    });
+
+    Hypergraph reduced_hypergraph = HypergraphFactory::construct(num_reduced_nodes, num_reduced_nets,
+      edge_vector, edge_weights.data(), reduced_node_weights.data(), stable_construction_of_incident_edges);
+    reduced_hypergraph.setNumRemovedHyperedges(hypergraph.numRemovedHyperedges());
+    reduced_hypergraph.setCommunityIDs(std::move(community_ids));
+    return reduced_hypergraph;
+  }
+
+} // namespace mt_kahypar::reduction
@@ -0,0 +1,51 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2021 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include "mt-kahypar/definitions.h"
+
+namespace mt_kahypar::reduction {
+  // ! Computes a representative for each vertex such that twin vertices (vertices
+  // ! with the same set of incident nets) share the same representative. The
+  // ! representative of a group of twins is its smallest vertex and the total weight
+  // ! of a group does not exceed max_node_weight (otherwise, the twins are split into
+  // ! several groups). Vertices with degree zero are their own representative.
+  vec<HypernodeID> computeTwinRepresentatives(const Hypergraph& hypergraph,
+                                              const HypernodeWeight max_node_weight);
+
+  // ! Constructs a copy of the hypergraph in which all vertices with the same
+  // ! representative are contracted into one vertex (representatives[u] = u, if u is
+  // ! not contracted). Nets that become single-pin nets are removed and, if
+  // ! merge_identical_nets is true, nets with the same pin set are merged into one
+  // ! net with their summed weight. After the call, node_mapping[u] contains the ID
+  // ! of vertex u in the reduced hypergraph.
+  Hypergraph reduceHypergraph(const Hypergraph& hypergraph,
+                              const vec<HypernodeID>& representatives,
+                              const bool merge_identical_nets,
+                              const bool stable_construction_of_incident_edges,
+                              vec<HypernodeID>& node_mapping);
+}
@@ -0,0 +1,289 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2021 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+
+#include "hypergraph_reordering.h"
+
+#include "tbb/enumerable_thread_specific.h"
+#include "tbb/parallel_for.h"
+#include "tbb/parallel_invoke.h"
+#include "tbb/parallel_sort.h"
+
+#include "mt-kahypar/datastructures/thread_safe_fast_reset_flag_array.h"
+
+namespace mt_kahypar::reordering {
+
+  namespace {
+    void fetchMin(CAtomic<HypernodeID>& value, const HypernodeID desired) {
+      HypernodeID current = value.load(std::memory_order_relaxed);
+      while ( desired < current &&
+              !value.compare_exchange_weak(current, desired, std::memory_order_relaxed) ) { }
+    }
+
+    // ! Level-synchronous parallel BFS. The vertices of the next level are labeled in
+    // ! the order of their parents (similar to Cuthill-McKee), where the parent of a
+    // ! vertex is the smallest labeled vertex of the previous level that discovers it.
+    // ! This makes the order independent of scheduling. Disconnected components are
+    // ! traversed in increasing order of their smallest vertex ID.
+    vec<HypernodeID> bfsOrder(const Hypergraph& hypergraph) {
+      const HypernodeID num_nodes = hypergraph.initialNumNodes();
+      const HyperedgeID num_edges = hypergraph.initialNumEdges();
+      vec<HypernodeID> node_mapping(num_nodes, kInvalidHypernode);
+      vec<CAtomic<HypernodeID>> node_parent(num_nodes, CAtomic<HypernodeID>(kInvalidHypernode));
+      vec<CAtomic<HypernodeID>> net_parent(num_edges, CAtomic<HypernodeID>(kInvalidHypernode));
+      ds::ThreadSafeFastResetFlagArray<> discovered_hns(num_nodes);
+      ds::ThreadSafeFastResetFlagArray<> discovered_hes(num_edges);
+      tbb::enumerable_thread_specific<vec<HyperedgeID>> local_nets;
+      tbb::enumerable_thread_specific<vec<HypernodeID>> local_nodes;
+
+      vec<HyperedgeID> nets;
+      vec<HypernodeID> frontier;
+      HypernodeID next_id = 0;
+      HypernodeID start = 0;
+      while ( next_id < num_nodes ) {
+        while ( discovered_hns[start] ) {
+          ++start;
+        }
+        ASSERT(start < num_nodes);
+        discovered_hns.set(start, true);
+        frontier.assign(1, start);
+
+        while ( !frontier.empty() ) {
+          tbb::parallel_for(0UL, frontier.size(), [&](const size_t i) {
+            node_mapping[frontier[i]] = next_id + i;
+          });
+          next_id += frontier.size();
+
+          // The parent of a net is the smallest labeled vertex of the current level
+          tbb::parallel_for(0UL, frontier.size(), [&](const size_t i) {
+            const HypernodeID u = frontier[i];
+            for ( const HyperedgeID& he : hypergraph.incidentEdges(u) ) {
+              fetchMin(net_parent[he], node_mapping[u]);
+              if ( discovered_hes.compare_and_set_to_true(he) ) {
+                local_nets.local().push_back(he);
+              }
+            }
+          });
+          nets.clear();
+          for ( vec<HyperedgeID>& local : local_nets ) {
+            nets.insert(nets.end(), local.begin(), local.end());
+            local.clear();
+          }
+
+          // The parent of an unlabeled vertex is the smallest parent of its nets
+          tbb::parallel_for(0UL, nets.size(), [&](const size_t i) {
+            const HyperedgeID he = nets[i];
+            const HypernodeID parent = net_parent[he].load(std::memory_order_relaxed);
+            for ( const HypernodeID& pin : hypergraph.pins(he) ) {
+              if ( node_mapping[pin] == kInvalidHypernode ) {
+                fetchMin(node_parent[pin], parent);
+                if ( discovered_hns.compare_and_set_to_true(pin) ) {
+                  local_nodes.local().push_back(pin);
+                }
+              }
+            }
+          });
+          frontier.clear();
+          for ( vec<HypernodeID>& local : local_nodes ) {
+            frontier.insert(frontier.end(), local.begin(), local.end());
+            local.clear();
+          }
+          tbb::parallel_sort(frontier.begin(), frontier.end(),
+            [&](const HypernodeID lhs, const HypernodeID rhs) {
+              const HypernodeID lhs_parent = node_parent[lhs].load(std::memory_order_relaxed);
+              const HypernodeID rhs_parent = node_parent[rhs].load(std::memory_order_relaxed);
+              return lhs_parent < rhs_parent || (lhs_parent == rhs_parent && lhs < rhs);
+            });
+        }
+      }
+      return node_mapping;
+    }
+
+    // ! Stores vertices of the same community consecutively. Within a
+    // ! community, the relative order of the vertices is preserved.
+    vec<HypernodeID> communityOrder(const Hypergraph& hypergraph) {
+      const HypernodeID num_nodes = hypergraph.initialNumNodes();
+      vec<HypernodeID> nodes(num_nodes);
+      tbb::parallel_for(ID(0), num_nodes, [&](const HypernodeID hn) {
+        nodes[hn] = hn;
+      });
+      tbb::parallel_sort(nodes.begin(), nodes.end(), [&](const HypernodeID lhs, const HypernodeID rhs) {
+        const PartitionID lhs_community = hypergraph.communityID(lhs);
+        const PartitionID rhs_community = hypergraph.communityID(rhs);
+        return lhs_community < rhs_community || (lhs_community == rhs_community && lhs < rhs);
+      });
+
+      vec<HypernodeID> node_mapping(num_nodes, kInvalidHypernode);
+      tbb::parallel_for(ID(0), num_nodes, [&](const HypernodeID pos) {
+        node_mapping[nodes[pos]] = pos;
+      });
+      return node_mapping;
+    }
+
+    // ! For graphs, each undirected edge is represented by two directed
+    // ! edges of which only one is used to construct the reordered graph
+    bool isRepresentativeEdge(const Hypergraph& hypergraph, const HyperedgeID he) {
+      if constexpr ( Hypergraph::is_graph ) {
+        auto pins = hypergraph.pins(he);
+        auto it = pins.begin();
+        const HypernodeID source = *it;
+        const HypernodeID target = *(++it);
+        return source < target;
+      } else {
+        unused(hypergraph);
+        unused(he);
+        return true;
+      }
+    }
+
+    // ! Position of a net in the edge vector from which the hypergraph was constructed.
+    // ! For graphs, this is the unique ID of the undirected edge.
+    template<typename HypergraphT>
+    HyperedgeID constructionID(const HypergraphT& hypergraph, const HyperedgeID he) {
+      if constexpr ( HypergraphT::is_graph ) {
+        return hypergraph.uniqueEdgeID(he);
+      } else {
+        unused(hypergraph);
+        return he;
+      }
+    }
+  } // namespace
+
+  vec<HypernodeID> computeNodeOrder(const Hypergraph& hypergraph, const NodeOrdering ordering) {
+    ASSERT(hypergraph.numRemovedHypernodes() == 0);
+    switch ( ordering ) {
+      case NodeOrdering::bfs: return bfsOrder(hypergraph);
+      case NodeOrdering::communities: return communityOrder(hypergraph);
+      case NodeOrdering::none:
+      case NodeOrdering::UNDEFINED:
+        break;
+    }
+
+    vec<HypernodeID> node_mapping(hypergraph.initialNumNodes());
+    tbb::parallel_for(ID(0), hypergraph.initialNumNodes(), [&](const HypernodeID hn) {
+      node_mapping[hn] = hn;
+    });
+    return node_mapping;
+  }
+
+  Hypergraph reorderHypergraph(const Hypergraph& hypergraph,
+                               const vec<HypernodeID>& node_mapping,
+                               const bool stable_construction_of_incident_edges,
+                               vec<HyperedgeID>& original_edge_ids) {
+    ASSERT(node_mapping.size() == hypergraph.initialNumNodes());
+    const HypernodeID num_nodes = hypergraph.initialNumNodes();
+
+    // Nets are ordered by their smallest pin after relabeling the vertices
+    using NetKey = std::pair<HypernodeID, HyperedgeID>;
+    tbb::enumerable_thread_specific<vec<NetKey>> local_nets;
+    hypergraph.doParallelForAllEdges([&](const HyperedgeID he) {
+      if ( isRepresentativeEdge(hypergraph, he) ) {
+        HypernodeID min_pin = kInvalidHypernode;
+        for ( const HypernodeID& pin : hypergraph.pins(he) ) {
+          min_pin = std::min(min_pin, node_mapping[pin]);
+        }
+        local_nets.local().emplace_back(min_pin, he);
+      }
+    });
+    vec<NetKey> nets;
+    for ( const vec<NetKey>& local : local_nets ) {
+      nets.insert(nets.end(), local.begin(), local.end());
+    }
+    tbb::parallel_sort(nets.begin(), nets.end());
+    const HyperedgeID num_nets = nets.size();
+
+    parallel::scalable_vector<parallel::scalable_vector<HypernodeID>> edge_vector(num_nets);
+    vec<HyperedgeWeight> edge_weights(num_nets);
+    vec<HypernodeWeight> node_weights(num_nodes);
+    ds::Clustering community_ids(num_nodes);
+    original_edge_ids.assign(num_nets, kInvalidHyperedge);
+    tbb::parallel_invoke([&] {
+      tbb::parallel_for(ID(0), num_nets, [&](const HyperedgeID pos) {
+        const HyperedgeID he = nets[pos].second;
+        // The pins keep their order such that restoreHypergraph(...) reproduces the input
+        for ( const HypernodeID& pin : hypergraph.pins(he) ) {
+          edge_vector[pos].push_back(node_mapping[pin]);
+        }
+        edge_weights[pos] = hypergraph.edgeWeight(he);
+        original_edge_ids[pos] = constructionID(hypergraph, he);
+      });
+    }, [&] {
+      tbb::parallel_for(ID(0), num_nodes, [&](const HypernodeID hn) {
+        node_weights[node_mapping[hn]] = hypergraph.nodeWeight(hn);
+        community_ids[node_mapping[hn]] = hypergraph.communityID(hn);
+      });
+    });
+
+    Hypergraph reordered_hypergraph = HypergraphFactory::construct(num_nodes, num_nets,
+      edge_vector, edge_weights.data(), node_weights.data(), stable_construction_of_incident_edges);
+    reordered_hypergraph.setNumRemovedHyperedges(hypergraph.numRemovedHyperedges());
+    reordered_hypergraph.setCommunityIDs(std::move(community_ids));
+    return reordered_hypergraph;
+  }
+
+  Hypergraph restoreHypergraph(const Hypergraph& reordered_hypergraph,
+                               const vec<HypernodeID>& node_mapping,
+                               const vec<HyperedgeID>& original_edge_ids,
+                               const bool stable_construction_of_incident_edges) {
+    const HypernodeID num_nodes = reordered_hypergraph.initialNumNodes();
+    const HyperedgeID num_nets = original_edge_ids.size();
+    ASSERT(node_mapping.size() == num_nodes);
+
+    vec<HypernodeID> original_node_ids(num_nodes);
+    tbb::parallel_for(ID(0), num_nodes, [&](const HypernodeID hn) {
+      original_node_ids[node_mapping[hn]] = hn;
+    });
+
+    parallel::scalable_vector<parallel::scalable_vector<HypernodeID>> edge_vector(num_nets);
+    vec<HyperedgeWeight> edge_weights(num_nets);
+    vec<HypernodeWeight> node_weights(num_nodes);
+    ds::Clustering community_ids(num_nodes);
+    tbb::parallel_invoke([&] {
+      reordered_hypergraph.doParallelForAllEdges([&](const HyperedgeID he) {
+        if ( isRepresentativeEdge(reordered_hypergraph, he) ) {
+          const HyperedgeID original_he = original_edge_ids[constructionID(reordered_hypergraph, he)];
+          ASSERT(original_he < num_nets && edge_vector[original_he].empty());
+          for ( const HypernodeID& pin : reordered_hypergraph.pins(he) ) {
+            edge_vector[original_he].push_back(original_node_ids[pin]);
+          }
+          edge_weights[original_he] = reordered_hypergraph.edgeWeight(he);
+        }
+      });
+    }, [&] {
+      tbb::parallel_for(ID(0), num_nodes, [&](const HypernodeID hn) {
+        node_weights[hn] = reordered_hypergraph.nodeWeight(node_mapping[hn]);
+        community_ids[hn] = reordered_hypergraph.communityID(node_mapping[hn]);
+      });
+    });
+
+    Hypergraph hypergraph = HypergraphFactory::construct(num_nodes, num_nets,
+      edge_vector, edge_weights.data(), node_weights.data(), stable_construction_of_incident_edges);
+    hypergraph.setNumRemovedHyperedges(reordered_hypergraph.numRemovedHyperedges());
+    hypergraph.setCommunityIDs(std::move(community_ids));
+    return hypergraph;
+  }
+
+} // namespace mt_kahypar::reordering
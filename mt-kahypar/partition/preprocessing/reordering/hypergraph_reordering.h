@@ -0,0 +1,57 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2021 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+
+#pragma once
+
+#include "mt-kahypar/definitions.h"
+#include "mt-kahypar/partition/context.h"
+
+namespace mt_kahypar::reordering {
+  // ! Computes a new ID for each vertex of the hypergraph such that vertices
+  // ! that are close to each other in the hypergraph (bfs) or in the same
+  // ! community (communities) are stored close to each other in memory
+  vec<HypernodeID> computeNodeOrder(const Hypergraph& hypergraph, const NodeOrdering ordering);
+
+  // ! Constructs a copy of the hypergraph in which the vertex u is relabeled to
+  // ! node_mapping[u] and the nets are ordered by their smallest (relabeled) pin.
+  // ! Vertex and net weights as well as the community IDs are transferred to the new IDs.
+  // ! After the call, original_edge_ids[e] contains the ID of net e in the input
+  // ! hypergraph (for graphs, the unique ID of the edge).
+  Hypergraph reorderHypergraph(const Hypergraph& hypergraph,
+                               const vec<HypernodeID>& node_mapping,
+                               const bool stable_construction_of_incident_edges,
+                               vec<HyperedgeID>& original_edge_ids);
+
+  // ! Inverse of reorderHypergraph(...). Reconstructs the input hypergraph (with its
+  // ! original vertex and net IDs and pin order) from the reordered hypergraph, which
+  // ! allows to release the input hypergraph while the reordered one is partitioned.
+  // ! Requires that no nets were removed from the input hypergraph before reordering.
+  Hypergraph restoreHypergraph(const Hypergraph& reordered_hypergraph,
+                               const vec<HypernodeID>& node_mapping,
+                               const vec<HyperedgeID>& original_edge_ids,
+                               const bool stable_construction_of_incident_edges);
+}
@@ -68,6 +68,51 @@ class DegreeZeroHypernodeRemover {
 
   // ! Restore degree-zero vertices
   void restoreDegreeZeroHypernodes(PartitionedHypergraph& hypergraph) {
+    binPackDegreeZeroHypernodes(hypergraph, _context,
+      [&](const PartitionID block) {
+        return hypergraph.partWeight(block);
+      }, [&](const HypernodeID hn, const PartitionID to) {
+        hypergraph.restoreDegreeZeroHypernode(hn, to);
+      });
+    _removed_hns.clear();
+  }
+
+  // ! Computes the blocks of the degree-zero vertices with the same bin-packing
+  // ! as restoreDegreeZeroHypernodes(...), but stores them in part_ids instead
+  // ! of restoring them. The hypergraph remains unchanged such that it can be
+  // ! partitioned again for a different number of blocks.
+  void assignDegreeZeroHypernodes(const PartitionedHypergraph& hypergraph,
+                                  const Context& context,
+                                  vec<PartitionID>& part_ids) {
+    vec<HypernodeWeight> part_weights(context.partition.k, 0);
+    for ( PartitionID block = 0; block < context.partition.k; ++block ) {
+      part_weights[block] = hypergraph.partWeight(block);
+    }
+    binPackDegreeZeroHypernodes(hypergraph, context,
+      [&](const PartitionID block) {
+        return part_weights[block];
+      }, [&](const HypernodeID hn, const PartitionID to) {
+        ASSERT(hn < part_ids.size());
+        part_ids[hn] = to;
+        part_weights[to] += hypergraph.nodeWeight(hn);
+      });
+  }
+
+  // ! Restores the degree-zero vertices only in the hypergraph (e.g., after their
+  // ! blocks were computed with assignDegreeZeroHypernodes(...))
+  void restoreDegreeZeroHypernodes(Hypergraph& hypergraph) {
+    for ( const HypernodeID& hn : _removed_hns ) {
+      hypergraph.restoreDegreeZeroHypernode(hn);
+    }
+    _removed_hns.clear();
+  }
+
+ private:
+  template<typename PartWeightFunc, typename AssignFunc>
+  void binPackDegreeZeroHypernodes(const PartitionedHypergraph& hypergraph,
+                                   const Context& context,
+                                   const PartWeightFunc& part_weight,
+                                   const AssignFunc& assign) {
     // Sort degree-zero vertices in decreasing order of their weight
     tbb::parallel_sort(_removed_hns.begin(), _removed_hns.end(),
       [&](const HypernodeID& lhs, const HypernodeID& rhs) {
@@ -76,9 +121,9 @@ class DegreeZeroHypernodeRemover {
       });
     // Sort blocks of partition in increasing order of their weight
     auto distance_to_max = [&](const PartitionID block) {
-      return hypergraph.partWeight(block) - _context.partition.max_part_weights[block];
+      return part_weight(block) - context.partition.max_part_weights[block];
     };
-    parallel::scalable_vector<PartitionID> blocks(_context.partition.k, 0);
+    parallel::scalable_vector<PartitionID> blocks(context.partition.k, 0);
     std::iota(blocks.begin(), blocks.end(), 0);
     std::sort(blocks.begin(), blocks.end(),
       [&](const PartitionID& lhs, const PartitionID& rhs) {
@@ -88,18 +133,16 @@ class DegreeZeroHypernodeRemover {
     // Perform Bin-Packing
     for ( const HypernodeID& hn : _removed_hns ) {
       PartitionID to = blocks.front();
-      hypergraph.restoreDegreeZeroHypernode(hn, to);
+      assign(hn, to);
       PartitionID i = 0;
-      while ( i + 1 < _context.partition.k &&
+      while ( i + 1 < context.partition.k &&
               distance_to_max(blocks[i]) > distance_to_max(blocks[i + 1]) ) {
         std::swap(blocks[i], blocks[i + 1]);
         ++i;
       }
     }
-    _removed_hns.clear();
   }
 
- private:
   const Context& _context;
   parallel::scalable_vector<HypernodeID> _removed_hns;
 };
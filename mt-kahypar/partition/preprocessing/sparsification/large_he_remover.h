@@ -26,6 +26,8 @@
 
 #pragma once
 
+#include "tbb/enumerable_thread_specific.h"
+
 #include "mt-kahypar/definitions.h"
 #include "mt-kahypar/partition/context.h"
 #include "mt-kahypar/parallel/stl/scalable_vector.h"
@@ -47,15 +49,39 @@ class LargeHyperedgeRemover {
 
   // ! Removes large hyperedges from the hypergraph
   // ! Returns the number of removed large hyperedges.
+  // ! Large hyperedges are detected in parallel. Each removal is parallelized
+  // ! over the pins of the hyperedge. If large hyperedges are approximated
+  // ! (see approximate_large_hyperedges), they are not removed, but excluded
+  // ! from the gain cache during refinement.
   HypernodeID removeLargeHyperedges(Hypergraph& hypergraph) {
     HypernodeID num_removed_large_hyperedges = 0;
     #ifndef USE_GRAPH_PARTITIONER
-    for ( const HyperedgeID& he : hypergraph.edges() ) {
-      if ( hypergraph.edgeSize(he) > largeHyperedgeThreshold() ) {
-        hypergraph.removeLargeEdge(he);
-        _removed_hes.push_back(he);
-        ++num_removed_large_hyperedges;
+    const HypernodeID threshold = largeHyperedgeThreshold();
+    tbb::enumerable_thread_specific<parallel::scalable_vector<HyperedgeID>> local_large_hes;
+    hypergraph.doParallelForAllEdges([&](const HyperedgeID& he) {
+      if ( hypergraph.edgeSize(he) > threshold ) {
+        local_large_hes.local().push_back(he);
+      }
+    });
+    parallel::scalable_vector<HyperedgeID> large_hes;
+    for ( const auto& hes : local_large_hes ) {
+      large_hes.insert(large_hes.end(), hes.begin(), hes.end());
+    }
+    // Removal order is independent of the thread scheduling
+    std::sort(large_hes.begin(), large_hes.end());
+
+    if ( _context.partition.approximate_large_hyperedges ) {
+      if ( _context.partition.verbose_output && !large_hes.empty() ) {
+        LOG << "Keep" << large_hes.size() << "large hyperedges (|e| >" << threshold
+            << ") with approximated gains";
       }
+      return 0;
+    }
+
+    for ( const HyperedgeID& he : large_hes ) {
+      hypergraph.removeLargeEdge(he);
+      _removed_hes.push_back(he);
+      ++num_removed_large_hyperedges;
     }
     std::reverse(_removed_hes.begin(), _removed_hes.end());
     #else
@@ -94,10 +120,16 @@ class LargeHyperedgeRemover {
     }
   }
 
+  // ! Restores all previously removed large hyperedges only in the hypergraph
+  // ! (e.g., if the partitions were extracted from the sanitized hypergraph)
+  void restoreLargeHyperedges(Hypergraph& hypergraph) {
+    for ( const HyperedgeID& he : _removed_hes ) {
+      hypergraph.restoreLargeEdge(he);
+    }
+  }
+
   HypernodeID largeHyperedgeThreshold() const {
-    return std::max(
-      _context.partition.large_hyperedge_size_threshold,
-      _context.partition.smallest_large_he_size_threshold);
+    return _context.largeHyperedgeThreshold();
   }
 
   void reset() {
@@ -0,0 +1,367 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2021 Lars Gottesbüren <lars.gottesbueren@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+
+#include "deterministic_multitry_fm.h"
+
+#include <numeric>
+
+#include <tbb/parallel_for.h>
+
+#include "mt-kahypar/partition/metrics.h"
+#include "mt-kahypar/parallel/chunking.h"
+
+namespace mt_kahypar {
+
+  bool DeterministicMultiTryFM::refineImpl(PartitionedHypergraph& phg,
+                                           const vec<HypernodeID>&,
+                                           Metrics& metrics,
+                                           const double) {
+    // Note that the time limit is ignored, since it would make the result depend on the running time
+    Gain overall_improvement = 0;
+    size_t consecutive_rounds_with_too_little_improvement = 0;
+    const size_t num_seeds = std::max(context.refinement.fm.num_seed_nodes, 1UL);
+
+    for (size_t round = 0; round < context.refinement.fm.multitry_rounds; ++round) {
+      collectBorderNodes(phg);
+      if (border_nodes.empty()) {
+        break;
+      }
+
+      // search i is initialized with the seed nodes [i * num_seeds, (i + 1) * num_seeds)
+      const size_t num_searches = parallel::chunking::idiv_ceil(border_nodes.size(), num_seeds);
+      const size_t num_sub_rounds = std::min(num_searches,
+        std::max(context.refinement.deterministic_refinement.num_sub_rounds_fm, 1UL));
+      const size_t num_searches_per_sub_round = parallel::chunking::idiv_ceil(num_searches, num_sub_rounds);
+      if (search_results.size() < num_searches_per_sub_round) {
+        search_results.resize(num_searches_per_sub_round);
+      }
+
+      Gain improvement = 0;
+      for (size_t sub_round = 0; sub_round < num_sub_rounds; ++sub_round) {
+        auto [first_search, last_search] = parallel::chunking::bounds(sub_round, num_searches, num_searches_per_sub_round);
+        if (first_search < last_search) {
+          improvement += performSubRound(phg, first_search, last_search, num_seeds);
+        }
+      }
+
+      const double round_improvement_fraction = improvementFraction(improvement, metrics.km1 - overall_improvement);
+      overall_improvement += improvement;
+      if (round_improvement_fraction < context.refinement.fm.min_improvement) {
+        consecutive_rounds_with_too_little_improvement++;
+      } else {
+        consecutive_rounds_with_too_little_improvement = 0;
+      }
+
+      if (context.type == ContextType::main) {
+        DBG << V(round) << V(improvement) << V(border_nodes.size()) << V(num_searches) << V(round_improvement_fraction);
+      }
+
+      if (improvement <= 0 || consecutive_rounds_with_too_little_improvement >= 2) {
+        break;
+      }
+    }
+
+    metrics.km1 -= overall_improvement;
+    metrics.imbalance = metrics::imbalance(phg, context);
+    ASSERT(metrics.km1 == metrics::km1(phg), V(metrics.km1) << V(metrics::km1(phg)));
+    return overall_improvement > 0;
+  }
+
+  void DeterministicMultiTryFM::initializeImpl(PartitionedHypergraph& phg) {
+    // The deterministic label propagation refiner does not maintain the gain cache.
+    // Since its initialization does not depend on the scheduling, we always recompute it.
+    phg.initializeGainCache(context.partition.approximate_large_hyperedges ?
+      context.largeHyperedgeThreshold() : std::numeric_limits<HypernodeID>::max());
+  }
+
+  void DeterministicMultiTryFM::collectBorderNodes(PartitionedHypergraph& phg) {
+    constexpr size_t num_buckets = utils::ParallelPermutation<HypernodeID>::num_buckets;
+    permutation.random_grouping(phg.initialNumNodes(), context.shared_memory.static_balancing_work_packages, prng());
+
+    auto is_border_node = [&](const HypernodeID u) {
+      return phg.nodeIsEnabled(u) && phg.isBorderNode(u);
+    };
+
+    // count border nodes per bucket and write them to their position in bucket order
+    border_nodes_per_bucket.assign(num_buckets + 1, 0);
+    tbb::parallel_for(0UL, num_buckets, [&](const size_t bucket) {
+      size_t num_border_nodes = 0;
+      for (size_t pos = permutation.bucket_bounds[bucket]; pos < permutation.bucket_bounds[bucket + 1]; ++pos) {
+        num_border_nodes += is_border_node(permutation.at(pos));
+      }
+      border_nodes_per_bucket[bucket + 1] = num_border_nodes;
+    });
+    std::partial_sum(border_nodes_per_bucket.begin(), border_nodes_per_bucket.end(), border_nodes_per_bucket.begin());
+
+    border_nodes.resize(border_nodes_per_bucket.back());
+    tbb::parallel_for(0UL, num_buckets, [&](const size_t bucket) {
+      size_t out = border_nodes_per_bucket[bucket];
+      for (size_t pos = permutation.bucket_bounds[bucket]; pos < permutation.bucket_bounds[bucket + 1]; ++pos) {
+        const HypernodeID u = permutation.at(pos);
+        if (is_border_node(u)) {
+          border_nodes[out++] = u;
+        }
+      }
+      ASSERT(out == border_nodes_per_bucket[bucket + 1]);
+    });
+  }
+
+  Gain DeterministicMultiTryFM::performSubRound(PartitionedHypergraph& phg,
+                                                const size_t first_search,
+                                                const size_t last_search,
+                                                const size_t num_seeds) {
+    const size_t num_searches = last_search - first_search;
+    ASSERT(num_searches <= search_results.size());
+
+    // the searches only read the global partition => their results do not depend on the scheduling
+    tbb::parallel_for(0UL, num_searches, [&](const size_t i) {
+      auto [first_seed, last_seed] = parallel::chunking::bounds(first_search + i, border_nodes.size(), num_seeds);
+      findMoves(phg, first_seed, last_seed, search_results[i]);
+    });
+
+    search_order.clear();
+    for (size_t i = 0; i < num_searches; ++i) {
+      if (!search_results[i].moves.empty()) {
+        search_order.push_back(i);
+      }
+    }
+    if (search_order.empty()) {
+      return 0;
+    }
+    std::sort(search_order.begin(), search_order.end(), [&](const size_t lhs, const size_t rhs) {
+      return search_results[lhs].improvement > search_results[rhs].improvement ||
+        (search_results[lhs].improvement == search_results[rhs].improvement && lhs < rhs);
+    });
+
+    // accept searches greedily if none of their nodes was moved by a previously accepted search
+    vec<HypernodeWeight> part_weights_before(phg.k());
+    for (PartitionID i = 0; i < phg.k(); ++i) {
+      part_weights_before[i] = phg.partWeight(i);
+    }
+    for (const size_t i : search_order) {
+      vec<Move>& moves = search_results[i].moves;
+      const bool conflicts = std::any_of(moves.begin(), moves.end(), [&](const Move& m) {
+        return is_claimed[m.node];
+      });
+      if (!conflicts) {
+        for (Move& m : moves) {
+          is_claimed[m.node] = true;
+          sharedData.moveTracker.insertMove(m);
+        }
+      }
+    }
+
+    // apply the global move sequence and revert to its best prefix (with respect to the exact gains)
+    const MoveID num_moves = sharedData.moveTracker.numPerformedMoves();
+    tbb::parallel_for(MoveID(0), num_moves, [&](const MoveID i) {
+      const Move& m = sharedData.moveTracker.moveOrder[i];
+      phg.changeNodePartWithGainCacheUpdate(m.node, m.from, m.to);
+      is_claimed[m.node] = false;
+    });
+    phg.resetMoveState();
+    return globalRollback.revertToBestPrefix<true>(phg, sharedData, part_weights_before);
+  }
+
+  template<typename PHG>
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
+  std::pair<PartitionID, Gain> DeterministicMultiTryFM::computeBestTargetBlock(LocalSearch& search,
+                                                                               const PHG& phg,
+                                                                               const HypernodeID u,
+                                                                               const PartitionID from) const {
+    for (PartitionID i = 0; i < phg.k(); ++i) {
+      search.benefits[i] = phg.moveToBenefit(u, i);
+      search.part_weights[i] = phg.partWeight(i);
+    }
+    const PartitionID to = target_block_selection::select(search.benefits.data(), search.part_weights.data(),
+      context.partition.max_part_weights.data(), phg.k(), from, phg.nodeWeight(u));
+    const Gain gain = to != kInvalidPartition ? search.benefits[to] - phg.moveFromPenalty(u)
+                                              : std::numeric_limits<Gain>::min();
+    return std::make_pair(to, gain);
+  }
+
+  template<typename PHG>
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
+  std::pair<PartitionID, Gain> DeterministicMultiTryFM::bestOfThree(const PHG& phg,
+                                                                    const HypernodeID u,
+                                                                    const PartitionID from,
+                                                                    const std::array<PartitionID, 3>& candidates) const {
+    // same tie breaking as in target_block_selection::selectScalar(...)
+    const HypernodeWeight wu = phg.nodeWeight(u);
+    PartitionID to = kInvalidPartition;
+    Gain to_benefit = std::numeric_limits<Gain>::min();
+    HypernodeWeight to_weight = std::numeric_limits<HypernodeWeight>::max();
+    for (const PartitionID i : candidates) {
+      if (i != from && i != kInvalidPartition) {
+        const Gain benefit = phg.moveToBenefit(u, i);
+        const HypernodeWeight weight = phg.partWeight(i);
+        if ( ( benefit > to_benefit || ( benefit == to_benefit &&
+               ( weight < to_weight || ( weight == to_weight && i < to ) ) ) ) &&
+             weight + wu <= context.partition.max_part_weights[i] ) {
+          to = i;
+          to_benefit = benefit;
+          to_weight = weight;
+        }
+      }
+    }
+    const Gain gain = to != kInvalidPartition ? to_benefit - phg.moveFromPenalty(u)
+                                              : std::numeric_limits<Gain>::min();
+    return std::make_pair(to, gain);
+  }
+
+  template<typename PHG>
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
+  void DeterministicMultiTryFM::insertOrUpdate(LocalSearch& search, const PHG& phg,
+                                               const HypernodeID u, const Move& m) {
+    const PartitionID pu = phg.partID(u);
+    if (search.search_of_node[u] != search.search_stamp) {
+      search.search_of_node[u] = search.search_stamp;
+      const auto [to, gain] = computeBestTargetBlock(search, phg, u, pu);
+      search.target_part[u] = to;
+      search.pq.insert(u, gain);
+    } else if (search.pq.contains(u)) {
+      // nodes that already were moved are not considered again
+      const PartitionID designated_target = search.target_part[u];
+      std::pair<PartitionID, Gain> best;
+      if (phg.k() < 4 || designated_target == m.from || designated_target == m.to) {
+        // the benefit of the designated target might have decreased => full recomputation
+        best = computeBestTargetBlock(search, phg, u, pu);
+      } else {
+        // only the benefits of m.from and m.to changed
+        best = bestOfThree(phg, u, pu, { designated_target, m.from, m.to });
+      }
+      search.target_part[u] = best.first;
+      search.pq.adjustKey(u, best.second);
+    }
+  }
+
+  void DeterministicMultiTryFM::findMoves(PartitionedHypergraph& phg,
+                                          const size_t first_seed,
+                                          const size_t last_seed,
+                                          SearchResult& result) {
+    LocalSearch& search = ets_search.local();
+    DeltaPartitionedHypergraph& delta_phg = search.delta_phg;
+    delta_phg.clear();
+    delta_phg.setPartitionedHypergraph(&phg);
+    search.pq.clear();
+    search.moves.clear();
+    if (++search.search_stamp == 0) {
+      search.search_of_node.assign(search.search_of_node.size(), 0);
+      search.search_stamp = 1;
+    }
+
+    const Move no_move { kInvalidPartition, kInvalidPartition, kInvalidHypernode, 0 };
+    for (size_t pos = first_seed; pos < last_seed; ++pos) {
+      insertOrUpdate(search, delta_phg, border_nodes[pos], no_move);
+    }
+
+    Move move;
+    auto delta_func = [&](const HyperedgeID he,
+                          const HyperedgeWeight edge_weight,
+                          const HypernodeID,
+                          const HypernodeID pin_count_in_from_part_after,
+                          const HypernodeID pin_count_in_to_part_after) {
+      // Gains of the pins of a hyperedge can only change in the following situations.
+      if (pin_count_in_from_part_after == 0 || pin_count_in_from_part_after == 1 ||
+          pin_count_in_to_part_after == 1 || pin_count_in_to_part_after == 2) {
+        search.edges_with_gain_changes.push_back(he);
+      }
+      delta_phg.gainCacheUpdate(he, edge_weight, move.from, pin_count_in_from_part_after,
+                                move.to, pin_count_in_to_part_after);
+    };
+
+    StopRule stop_rule(phg.initialNumNodes());
+    Gain estimated_improvement = 0;
+    Gain best_improvement = 0;
+    size_t best_improvement_index = 0;
+    while (!search.pq.empty() && !stop_rule.searchShouldStop()) {
+      const HypernodeID u = search.pq.top();
+      // the key of u might be outdated, since part weights changed
+      const auto [to, gain] = computeBestTargetBlock(search, delta_phg, u, delta_phg.partID(u));
+      if (to == kInvalidPartition) {
+        search.pq.deleteTop();
+        continue;
+      } else if (gain < search.pq.topKey()) {
+        search.target_part[u] = to;
+        search.pq.adjustKey(u, gain);
+        continue;
+      }
+      search.pq.deleteTop();
+
+      move = Move { delta_phg.partID(u), to, u, gain };
+      HypernodeWeight heaviest_part_weight = 0;
+      for (PartitionID i = 0; i < delta_phg.k(); ++i) {
+        heaviest_part_weight = std::max(heaviest_part_weight, delta_phg.partWeight(i));
+      }
+      const HypernodeWeight from_weight = delta_phg.partWeight(move.from);
+      const HypernodeWeight to_weight = delta_phg.partWeight(move.to);
+
+      search.edges_with_gain_changes.clear();
+      if (delta_phg.changeNodePart(u, move.from, move.to, context.partition.max_part_weights[move.to], delta_func)) {
+        estimated_improvement += gain;
+        search.moves.push_back(move);
+        stop_rule.update(gain);
+        const bool improved_km1 = estimated_improvement > best_improvement;
+        const bool improved_balance_less_equal_km1 = estimated_improvement >= best_improvement
+                                                     && from_weight == heaviest_part_weight
+                                                     && to_weight + phg.nodeWeight(u) < heaviest_part_weight;
+        if (improved_km1 || improved_balance_less_equal_km1) {
+          stop_rule.reset();
+          best_improvement = estimated_improvement;
+          best_improvement_index = search.moves.size();
+        }
+
+        if (stop_rule.searchShouldStop()) {
+          break;
+        }
+
+        for (const HyperedgeID e : search.edges_with_gain_changes) {
+          if (delta_phg.edgeSize(e) < context.partition.ignore_hyperedge_size_threshold) {
+            for (const HypernodeID v : delta_phg.pins(e)) {
+              if (search.neighbor_deduplicator[v] != search.deduplication_time) {
+                insertOrUpdate(search, delta_phg, v, move);
+                search.neighbor_deduplicator[v] = search.deduplication_time;
+              }
+            }
+          }
+        }
+        if (++search.deduplication_time == 0) {
+          search.neighbor_deduplicator.assign(search.neighbor_deduplicator.size(), 0);
+          search.deduplication_time = 1;
+        }
+      }
+    }
+
+    result.improvement = best_improvement;
+    result.moves.assign(search.moves.begin(), search.moves.begin() + best_improvement_index);
+
+    if (delta_phg.combinedMemoryConsumption() > sharedData.deltaMemoryLimitPerThread) {
+      // hash tables grew too large in this search, shrink them for the next one
+      delta_phg.resetMemory();
+    }
+  }
+
+} // namespace mt_kahypar
@@ -0,0 +1,172 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2021 Lars Gottesbüren <lars.gottesbueren@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+
+#pragma once
+
+#include <array>
+
+#include <tbb/enumerable_thread_specific.h>
+
+#include "mt-kahypar/definitions.h"
+#include "mt-kahypar/datastructures/priority_queue.h"
+#include "mt-kahypar/partition/context.h"
+#include "mt-kahypar/partition/refinement/i_refiner.h"
+#include "mt-kahypar/partition/refinement/fm/fm_commons.h"
+#include "mt-kahypar/partition/refinement/fm/global_rollback.h"
+#include "mt-kahypar/partition/refinement/fm/stop_rule.h"
+#include "mt-kahypar/partition/refinement/fm/strategies/target_block_selection.h"
+#include "mt-kahypar/utils/reproducible_random.h"
+
+namespace mt_kahypar {
+
+/*!
+ * Deterministic version of the multitry k-way FM refiner.
+ *
+ * Each round is split into synchronous sub-rounds. In a sub-round, a fixed set of
+ * localized FM searches is started from disjoint groups of seed nodes (taken from a
+ * random permutation of the border nodes that only depends on the seed). The searches
+ * run concurrently on thread-local delta partitions and only read the global partition
+ * and gain cache, which are not modified until all searches of the sub-round finished. Hence, the move
+ * sequence found by a search does not depend on the scheduling of the searches.
+ * Afterwards, the searches are ordered by their improvement (ties broken by search index)
+ * and the moves of a search are appended to the global move sequence if none of its
+ * nodes was already moved by a previously accepted search. Finally, the global rollback
+ * recomputes the exact gains of the global move sequence and reverts to its best prefix.
+ */
+class DeterministicMultiTryFM final : public IRefiner {
+
+  static constexpr bool debug = false;
+
+  struct LocalSearch {
+    explicit LocalSearch(const Context& context, const HypernodeID num_nodes) :
+      delta_phg(context),
+      pq(num_nodes),
+      target_part(num_nodes, kInvalidPartition),
+      search_of_node(num_nodes, 0),
+      neighbor_deduplicator(num_nodes, 0),
+      benefits(context.partition.k, 0),
+      part_weights(context.partition.k, 0) { }
+
+    // ! Thread-local partition (and gain cache delta) on which the moves of a search are performed
+    DeltaPartitionedHypergraph delta_phg;
+    ds::ExclusiveHandleHeap< ds::MaxHeap<Gain, HypernodeID> > pq;
+    // ! Designated target block of the nodes in the PQ
+    vec<PartitionID> target_part;
+    // ! Marks the nodes that were inserted into the PQ in the current search
+    vec<uint32_t> search_of_node;
+    uint32_t search_stamp = 0;
+    // ! Stores whether a neighbor of the last moved vertex has already been updated
+    vec<uint32_t> neighbor_deduplicator;
+    uint32_t deduplication_time = 0;
+    vec<HyperedgeID> edges_with_gain_changes;
+    vec<Move> moves;
+    // ! Buffers for the target block selection
+    vec<Gain> benefits;
+    vec<HypernodeWeight> part_weights;
+  };
+
+  struct SearchResult {
+    Gain improvement = 0;
+    vec<Move> moves;
+  };
+
+public:
+  explicit DeterministicMultiTryFM(const Hypergraph& hypergraph,
+                                   const Context& context) :
+    context(context),
+    sharedData(hypergraph.initialNumNodes(), context.partition.k,
+               TBBInitializer::instance().total_number_of_threads(),
+               0, context.refinement.fm.delta_memory_fraction),
+    globalRollback(hypergraph, context),
+    ets_search([&context, num_nodes = hypergraph.initialNumNodes()] {
+      return LocalSearch(context, num_nodes);
+    }),
+    prng(context.partition.seed),
+    is_claimed(hypergraph.initialNumNodes(), false) { }
+
+private:
+  bool refineImpl(PartitionedHypergraph& phg,
+                  const vec<HypernodeID>& refinement_nodes,
+                  Metrics& metrics,
+                  double) final ;
+
+  void initializeImpl(PartitionedHypergraph& phg) final;
+
+  // ! Collects the border nodes in the order of a random permutation
+  void collectBorderNodes(PartitionedHypergraph& phg);
+
+  // ! Runs the searches [first_search, last_search) concurrently and applies
+  // ! the moves of non-conflicting searches to the global partition
+  Gain performSubRound(PartitionedHypergraph& phg,
+                       const size_t first_search,
+                       const size_t last_search,
+                       const size_t num_seeds);
+
+  // ! Localized FM search on a thread-local delta partition. Stores the best prefix of
+  // ! the move sequence in result.
+  void findMoves(PartitionedHypergraph& phg,
+                 const size_t first_seed,
+                 const size_t last_seed,
+                 SearchResult& result);
+
+  // ! Inserts u into the PQ of the search or updates its gain after the move m,
+  // ! if u is still contained in the PQ
+  template<typename PHG>
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
+  void insertOrUpdate(LocalSearch& search, const PHG& phg, const HypernodeID u, const Move& m);
+
+  // ! Best target block of u with respect to the gain cache
+  template<typename PHG>
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
+  std::pair<PartitionID, Gain> computeBestTargetBlock(LocalSearch& search, const PHG& phg,
+                                                      const HypernodeID u, const PartitionID from) const;
+
+  // ! Best target block of u among the given candidates
+  template<typename PHG>
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
+  std::pair<PartitionID, Gain> bestOfThree(const PHG& phg, const HypernodeID u, const PartitionID from,
+                                           const std::array<PartitionID, 3>& candidates) const;
+
+  static double improvementFraction(const Gain gain, const HyperedgeWeight old_km1) {
+    return old_km1 == 0 ? 0 : static_cast<double>(gain) / static_cast<double>(old_km1);
+  }
+
+  const Context& context;
+  FMSharedData sharedData;
+  GlobalRollback globalRollback;
+  tbb::enumerable_thread_specific<LocalSearch> ets_search;
+
+  std::mt19937 prng;
+  utils::ParallelPermutation<HypernodeID> permutation;
+  vec<HypernodeID> border_nodes;
+  vec<size_t> border_nodes_per_bucket;
+  vec<SearchResult> search_results;
+  vec<size_t> search_order;
+  vec<uint8_t> is_claimed;
+};
+
+}
@@ -30,6 +30,7 @@
 #include <mt-kahypar/datastructures/priority_queue.h>
 #include <mt-kahypar/partition/context.h>
 #include <mt-kahypar/parallel/work_stack.h>
+#include <mt-kahypar/utils/memory_info.h>
 
 #include "external_tools/kahypar/kahypar/datastructure/fast_reset_flag_array.h"
 
@@ -167,14 +168,17 @@ struct FMSharedData {
   CAtomic<size_t> finishedTasks;
   size_t finishedTasksLimit = std::numeric_limits<size_t>::max();
 
-  // ! Switch to applying moves directly if the use of local delta partitions exceeded a memory limit
-  bool deltaExceededMemoryConstraints = false;
+  // ! A localized search stops early if its local delta partition exceeds this memory limit
   size_t deltaMemoryLimitPerThread = 0;
 
+  // ! Bucket vertex priority queues store gains in [-maxBucketGain, maxBucketGain] in buckets
+  Gain maxBucketGain = 0;
+
   bool release_nodes = true;
   bool perform_moves_global = true;
 
-  FMSharedData(size_t numNodes = 0, PartitionID numParts = 0, size_t numThreads = 0, size_t numPQHandles = 0) :
+  FMSharedData(size_t numNodes = 0, PartitionID numParts = 0, size_t numThreads = 0, size_t numPQHandles = 0,
+               double deltaMemoryFraction = 0.5) :
           refinementNodes(), //numNodes, numThreads),
           vertexPQHandles(), //numPQHandles, invalid_position),
           numParts(numParts),
@@ -184,8 +188,9 @@ struct FMSharedData {
   {
     finishedTasks.store(0, std::memory_order_relaxed);
 
-    // 128 * 3/2 GB --> roughly 1.5 GB per thread on our biggest machine
-    deltaMemoryLimitPerThread = 128UL * (1UL << 30) * 3 / ( 2 * std::max(1UL, numThreads) );
+    // the delta partitions of all threads share the given fraction of the physical memory
+    deltaMemoryLimitPerThread = static_cast<size_t>(
+      deltaMemoryFraction * utils::physicalMemory() / std::max(1UL, numThreads));
 
     tbb::parallel_invoke([&] {
       moveTracker.moveOrder.resize(numNodes);
@@ -207,7 +212,8 @@ struct FMSharedData {
                 numNodes,
                 context.partition.k,
                 TBBInitializer::instance().total_number_of_threads(),
-                getNumberOfPQHandles(context, numNodes)
+                getNumberOfPQHandles(context, numNodes),
+                context.refinement.fm.delta_memory_fraction
                 )  { }
 
 
@@ -26,127 +26,76 @@
 
 #include "mt-kahypar/partition/refinement/fm/global_rollback.h"
 
-#include "tbb/parallel_scan.h"
 #include "mt-kahypar/partition/metrics.h"
 #include "mt-kahypar/utils/timer.h"
 
 namespace mt_kahypar {
 
-  struct BalanceAndBestIndexScan {
-    const PartitionedHypergraph& phg;
-    const vec<Move>& moves;
-
-    struct Prefix {
+  namespace {
+    struct BestPrefix {
       Gain gain = 0;                           /** gain when using valid moves up to best_index */
       MoveID best_index = 0;                   /** local ID of first move to revert */
       HypernodeWeight heaviest_weight =
               std::numeric_limits<HypernodeWeight>::max();   /** weight of the heaviest part */
 
-      bool operator<(const Prefix& o) const {
+      bool operator<(const BestPrefix& o) const {
         return gain > o.gain ||
                (gain == o.gain && std::tie(heaviest_weight, best_index) < std::tie(o.heaviest_weight, o.best_index));
       }
     };
-    std::shared_ptr< tbb::enumerable_thread_specific<Prefix> > local_best;
-
-    Gain gain_sum = 0;
-
-    vec<HypernodeWeight> part_weights;
-    const std::vector<HypernodeWeight>& max_part_weights;
-
-    BalanceAndBestIndexScan(BalanceAndBestIndexScan& b, tbb::split) :
-            phg(b.phg),
-            moves(b.moves),
-            local_best(b.local_best),
-            gain_sum(0),
-            part_weights(b.part_weights.size(), 0),
-            max_part_weights(b.max_part_weights) { }
-
-
-    BalanceAndBestIndexScan(const PartitionedHypergraph& phg,
-                            const vec<Move>& moves,
-                            const vec<HypernodeWeight>& part_weights,
-                            const std::vector<HypernodeWeight>& max_part_weights) :
-            phg(phg),
-            moves(moves),
-            local_best(std::make_shared< tbb::enumerable_thread_specific<Prefix> >()),
-            part_weights(part_weights),
-            max_part_weights(max_part_weights)
-    {
-    }
 
+    /**
+     * Consecutive range of the move order. Part weight changes are stored sparsely,
+     * i.e., only for the blocks touched by moves of the range, such that no range
+     * has to hold a copy of all k part weights.
+     */
+    struct MoveRange {
+      MoveID begin = 0;
+      MoveID end = 0;
+      Gain gain = 0;                                                /** gain sum of the valid moves */
+      vec<std::pair<PartitionID, HypernodeWeight>> weight_deltas;   /** weight change of each touched block */
+
+      // state before the first move of the range
+      Gain gain_before = 0;
+      size_t overloaded_before = 0;
+      vec<HypernodeWeight> weights_before;                          /** weights of the touched blocks */
+      HypernodeWeight heaviest_untouched_weight = std::numeric_limits<HypernodeWeight>::min();
+    };
 
-    void operator()(const tbb::blocked_range<MoveID>& r, tbb::pre_scan_tag ) {
-      for (MoveID i = r.begin(); i < r.end(); ++i) {
-        const Move& m = moves[i];
-        if (m.isValid()) {  // skip locally reverted moves
-          gain_sum += m.gain;
-          part_weights[m.from] -= phg.nodeWeight(m.node);
-          part_weights[m.to] += phg.nodeWeight(m.node);
+    // ! Complete binary tree over the part weights that maintains their maximum
+    class MaxPartWeightTree {
+     public:
+      explicit MaxPartWeightTree(const vec<HypernodeWeight>& part_weights) :
+        _size(1),
+        _tree() {
+        while ( _size < part_weights.size() ) {
+          _size <<= 1;
         }
-      }
-    }
-
-    // subranges a | b | c | d . assuming this ran pre_scan on c,
-    // then lhs ran pre_scan on b and final_scan of this will be on d
-    void reverse_join(BalanceAndBestIndexScan& lhs) {
-      for (size_t i = 0; i < part_weights.size(); ++i) {
-        part_weights[i] += lhs.part_weights[i];
-      }
-      gain_sum += lhs.gain_sum;
-    }
-
-    void operator()(const tbb::blocked_range<MoveID>& r, tbb::final_scan_tag ) {
-      size_t overloaded = 0;
-      for (size_t i = 0; i < part_weights.size(); ++i) {
-        if (part_weights[i] > max_part_weights[i]) {
-          overloaded++;
+        _tree.assign(2 * _size, std::numeric_limits<HypernodeWeight>::min());
+        std::copy(part_weights.begin(), part_weights.end(), _tree.begin() + _size);
+        for ( size_t i = _size - 1; i > 0; --i ) {
+          _tree[i] = std::max(_tree[2 * i], _tree[2 * i + 1]);
         }
       }
 
-      Prefix current;
-      for (MoveID i = r.begin(); i < r.end(); ++i) {
-        const Move& m = moves[i];
-
-        if (m.isValid()) {  // skip locally reverted moves
-          gain_sum += m.gain;
-
-          const bool from_overloaded = part_weights[m.from] > max_part_weights[m.from];
-          part_weights[m.from] -= phg.nodeWeight(m.node);
-          if (from_overloaded && part_weights[m.from] <= max_part_weights[m.from]) {
-            overloaded--;
-          }
-          const bool to_overloaded = part_weights[m.to] > max_part_weights[m.to];
-          part_weights[m.to] += phg.nodeWeight(m.node);
-          if (!to_overloaded && part_weights[m.to] > max_part_weights[m.to]) {
-            overloaded++;
-          }
-
-          if (overloaded == 0 && gain_sum >= current.gain) {
-            Prefix new_prefix = { gain_sum, i + 1, *std::max_element(part_weights.begin(), part_weights.end()) };
-            current = std::min(current, new_prefix);
-          }
+      void update(const PartitionID block, const HypernodeWeight weight) {
+        size_t pos = _size + block;
+        _tree[pos] = weight;
+        while ( pos > 1 ) {
+          pos >>= 1;
+          _tree[pos] = std::max(_tree[2 * pos], _tree[2 * pos + 1]);
         }
       }
 
-      if (current.best_index != 0) {
-        Prefix& lb = local_best->local();
-        lb = std::min(lb, current);
+      HypernodeWeight max() const {
+        return _tree[1];
       }
-    }
-
-    void assign(BalanceAndBestIndexScan& b) {
-      gain_sum = b.gain_sum;
-    }
 
-    Prefix finalize(const vec<HypernodeWeight>& initial_part_weights) {
-      Prefix res { 0, 0, *std::max_element(initial_part_weights.begin(), initial_part_weights.end()) };
-      for (const Prefix& x : *local_best) {
-        res = std::min(res, x);
-      }
-      return res;
-    }
-  };
+     private:
+      size_t _size;
+      vec<HypernodeWeight> _tree;
+    };
+  } // namespace
 
   template<bool update_gain_cache>
   HyperedgeWeight GlobalRollback::revertToBestPrefix(
@@ -184,10 +133,115 @@ namespace mt_kahypar {
     recalculateGains(phg, sharedData);
     HEAVY_REFINEMENT_ASSERT(verifyGains<update_gain_cache>(phg, sharedData));
 
-    BalanceAndBestIndexScan s(phg, move_order, partWeights, maxPartWeights);
-    // TODO set grain size in blocked_range? to avoid too many copies of part weights array. experiment with different values
-    tbb::parallel_scan(tbb::blocked_range<MoveID>(0, numMoves), s);
-    BalanceAndBestIndexScan::Prefix b = s.finalize(partWeights);
+    // The move order is split into ranges, which are processed in three passes:
+    // 1.) compute the gain and the (sparse) part weight changes of each range in parallel
+    // 2.) compute the state before each range with a sequential prefix sum over the ranges
+    // 3.) search the best prefix within each range in parallel
+    const size_t num_ranges = std::max(size_t(1), std::min(
+      static_cast<size_t>(numMoves / MIN_MOVES_PER_ROLLBACK_RANGE), 4 * context.shared_memory.num_threads));
+    vec<MoveRange> ranges(num_ranges);
+    tbb::parallel_for(size_t(0), num_ranges, [&](const size_t r) {
+      MoveRange& range = ranges[r];
+      range.begin = (static_cast<uint64_t>(numMoves) * r) / num_ranges;
+      range.end = (static_cast<uint64_t>(numMoves) * (r + 1)) / num_ranges;
+      ds::SparseMap<PartitionID, HypernodeWeight>& deltas = ets_part_weights.local();
+      deltas.clear();
+      for (MoveID i = range.begin; i < range.end; ++i) {
+        const Move& m = move_order[i];
+        if (m.isValid()) {  // skip locally reverted moves
+          range.gain += m.gain;
+          deltas[m.from] -= phg.nodeWeight(m.node);
+          deltas[m.to] += phg.nodeWeight(m.node);
+        }
+      }
+      for (const auto& delta : deltas) {
+        range.weight_deltas.emplace_back(delta.key, delta.value);
+      }
+    });
+
+    vec<HypernodeWeight> part_weights = partWeights;
+    MaxPartWeightTree heaviest_part(part_weights);
+    size_t overloaded = 0;
+    for (PartitionID i = 0; i < num_parts; ++i) {
+      if (part_weights[i] > maxPartWeights[i]) {
+        overloaded++;
+      }
+    }
+    Gain gain_sum = 0;
+    for (MoveRange& range : ranges) {
+      range.gain_before = gain_sum;
+      range.overloaded_before = overloaded;
+      range.weights_before.resize(range.weight_deltas.size());
+      for (size_t j = 0; j < range.weight_deltas.size(); ++j) {
+        const PartitionID block = range.weight_deltas[j].first;
+        range.weights_before[j] = part_weights[block];
+        heaviest_part.update(block, std::numeric_limits<HypernodeWeight>::min());
+      }
+      range.heaviest_untouched_weight = heaviest_part.max();
+
+      for (const auto& [block, delta] : range.weight_deltas) {
+        const bool was_overloaded = part_weights[block] > maxPartWeights[block];
+        part_weights[block] += delta;
+        const bool is_overloaded = part_weights[block] > maxPartWeights[block];
+        if (was_overloaded && !is_overloaded) {
+          overloaded--;
+        } else if (!was_overloaded && is_overloaded) {
+          overloaded++;
+        }
+        heaviest_part.update(block, part_weights[block]);
+      }
+      gain_sum += range.gain;
+    }
+
+    vec<BestPrefix> best_in_range(num_ranges);
+    tbb::parallel_for(size_t(0), num_ranges, [&](const size_t r) {
+      const MoveRange& range = ranges[r];
+      ds::SparseMap<PartitionID, HypernodeWeight>& weights = ets_part_weights.local();
+      weights.clear();
+      for (size_t j = 0; j < range.weight_deltas.size(); ++j) {
+        weights[range.weight_deltas[j].first] = range.weights_before[j];
+      }
+
+      Gain current_gain = range.gain_before;
+      size_t current_overloaded = range.overloaded_before;
+      BestPrefix current;
+      for (MoveID i = range.begin; i < range.end; ++i) {
+        const Move& m = move_order[i];
+
+        if (m.isValid()) {  // skip locally reverted moves
+          current_gain += m.gain;
+
+          HypernodeWeight& from_weight = weights[m.from];
+          const bool from_overloaded = from_weight > maxPartWeights[m.from];
+          from_weight -= phg.nodeWeight(m.node);
+          if (from_overloaded && from_weight <= maxPartWeights[m.from]) {
+            current_overloaded--;
+          }
+          HypernodeWeight& to_weight = weights[m.to];
+          const bool to_overloaded = to_weight > maxPartWeights[m.to];
+          to_weight += phg.nodeWeight(m.node);
+          if (!to_overloaded && to_weight > maxPartWeights[m.to]) {
+            current_overloaded++;
+          }
+
+          if (current_overloaded == 0 && current_gain >= current.gain) {
+            HypernodeWeight heaviest_weight = range.heaviest_untouched_weight;
+            for (const auto& block : weights) {
+              heaviest_weight = std::max(heaviest_weight, block.value);
+            }
+            current = std::min(current, BestPrefix { current_gain, i + 1, heaviest_weight });
+          }
+        }
+      }
+      best_in_range[r] = current;
+    });
+
+    BestPrefix b { 0, 0, *std::max_element(partWeights.begin(), partWeights.end()) };
+    for (const BestPrefix& x : best_in_range) {
+      if (x.best_index != 0) {
+        b = std::min(b, x);
+      }
+    }
 
     tbb::parallel_for(b.best_index, numMoves, [&](const MoveID moveID) {
       const Move& m = move_order[moveID];
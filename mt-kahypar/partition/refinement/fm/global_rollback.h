@@ -28,6 +28,7 @@
 
 #include "tbb/parallel_invoke.h"
 
+#include "mt-kahypar/datastructures/sparse_map.h"
 #include "mt-kahypar/partition/refinement/fm/fm_commons.h"
 
 
@@ -35,12 +36,17 @@ namespace mt_kahypar {
 
 class GlobalRollback {
   static constexpr bool enable_heavy_assert = false;
+  // ! Minimum number of moves processed by a task of the parallel rollback
+  static constexpr MoveID MIN_MOVES_PER_ROLLBACK_RANGE = 2048;
 public:
   explicit GlobalRollback(const Hypergraph& hg, const Context& context) :
           context(context),
           max_part_weight_scaling(context.refinement.fm.rollback_balance_violation_factor),
           num_parts(context.partition.k),
           ets_recalc_data(vec<RecalculationData>(num_parts)),
+          ets_part_weights([&] {
+            return ds::SparseMap<PartitionID, HypernodeWeight>(num_parts);
+          }),
           last_recalc_round(),
           round(1)
   {
@@ -100,6 +106,8 @@ private:
   };
 
   tbb::enumerable_thread_specific< vec<RecalculationData> > ets_recalc_data;
+  // ! Sparse part weights (or part weight changes) of the blocks touched by a range of moves
+  tbb::enumerable_thread_specific< ds::SparseMap<PartitionID, HypernodeWeight> > ets_part_weights;
   vec<CAtomic<uint32_t>> last_recalc_round;
   uint32_t round;
 };
@@ -43,18 +43,15 @@ namespace mt_kahypar {
     }
 
     if (runStats.pushes > 0) {
-      if (sharedData.deltaExceededMemoryConstraints) {
-        deltaPhg.dropMemory();
-      }
-
-      if (context.refinement.fm.perform_moves_global || sharedData.deltaExceededMemoryConstraints) {
+      if (context.refinement.fm.perform_moves_global) {
         internalFindMoves<false>(phg);
       } else {
         deltaPhg.clear();
         deltaPhg.setPartitionedHypergraph(&phg);
         internalFindMoves<true>(phg);
         if (deltaPhg.combinedMemoryConsumption() > sharedData.deltaMemoryLimitPerThread) {
-          sharedData.deltaExceededMemoryConstraints = true;
+          // hash tables grew too large in this search, shrink them for the next one
+          deltaPhg.resetMemory();
         }
       }
       return true;
@@ -228,6 +225,14 @@ namespace mt_kahypar {
           break;
         }
 
+        if constexpr (use_delta) {
+          // bound the memory of the local delta partition: stop the search
+          // (the best prefix found so far is still applied)
+          if (deltaPhg.combinedMemoryConsumption() > sharedData.deltaMemoryLimitPerThread) {
+            break;
+          }
+        }
+
         if constexpr (use_delta) {
           acquireOrUpdateNeighbors(deltaPhg, move);
         } else {
@@ -399,6 +404,7 @@ namespace mt_kahypar {
 
 namespace mt_kahypar {
   template class LocalizedKWayFM<GainCacheStrategy>;
+  template class LocalizedKWayFM<GainCacheBucketPQStrategy>;
   template class LocalizedKWayFM<GainDeltaStrategy>;
   template class LocalizedKWayFM<RecomputeGainStrategy>;
   template class LocalizedKWayFM<GainCacheOnDemandStrategy>;
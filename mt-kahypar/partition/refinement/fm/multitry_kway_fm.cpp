@@ -202,7 +202,8 @@ namespace mt_kahypar {
     }
 
     if (!phg.isGainCacheInitialized() && FMStrategy::maintain_gain_cache_between_rounds) {
-      phg.initializeGainCache();
+      phg.initializeGainCache(context.partition.approximate_large_hyperedges ?
+        context.largeHyperedgeThreshold() : std::numeric_limits<HypernodeID>::max());
     }
 
     is_initialized = true;
@@ -231,6 +232,7 @@ namespace mt_kahypar {
 
 namespace mt_kahypar {
   template class MultiTryKWayFM<GainCacheStrategy>;
+  template class MultiTryKWayFM<GainCacheBucketPQStrategy>;
   template class MultiTryKWayFM<GainDeltaStrategy>;
   template class MultiTryKWayFM<RecomputeGainStrategy>;
   template class MultiTryKWayFM<GainCacheOnDemandStrategy>;
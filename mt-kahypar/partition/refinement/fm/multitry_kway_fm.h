@@ -47,8 +47,11 @@ class MultiTryKWayFM final : public IRefiner {
 
 public:
 
+  // ! max_bucket_gain bounds the gains stored in the buckets of bucket vertex
+  // ! priority queues (e.g., the maximum weighted degree of the hypergraph)
   MultiTryKWayFM(const Hypergraph& hypergraph,
-                 const Context& c) :
+                 const Context& c,
+                 const Gain max_bucket_gain = 0) :
     initial_num_nodes(hypergraph.initialNumNodes()),
     context(c),
     sharedData(hypergraph.initialNumNodes(), context),
@@ -58,6 +61,7 @@ public:
     if (context.refinement.fm.obey_minimal_parallelism) {
       sharedData.finishedTasksLimit = std::min(8UL, context.shared_memory.num_threads);
     }
+    sharedData.maxBucketGain = max_bucket_gain;
   }
 
   bool refineImpl(PartitionedHypergraph& phg,
@@ -26,7 +26,9 @@
 
 #pragma once
 
+#include "mt-kahypar/datastructures/bucket_priority_queue.h"
 #include "mt-kahypar/partition/refinement/fm/fm_commons.h"
+#include "mt-kahypar/partition/refinement/fm/strategies/target_block_selection.h"
 
 
 namespace mt_kahypar {
@@ -45,25 +47,27 @@ namespace mt_kahypar {
    *
    */
 
-class GainCacheStrategy {
+// ! The vertex priority queues are either binary heaps or bucket queues (for small gain ranges)
+template<typename VertexPriorityQueueT>
+class GainCacheStrategyT {
 public:
 
   using BlockPriorityQueue = ds::ExclusiveHandleHeap< ds::MaxHeap<Gain, PartitionID> >;
-  using VertexPriorityQueue = ds::MaxHeap<Gain, HypernodeID>;    // these need external handles
+  using VertexPriorityQueue = VertexPriorityQueueT;    // these need external handles
 
   static constexpr bool uses_gain_cache = true;
   static constexpr bool maintain_gain_cache_between_rounds = true;
 
-  GainCacheStrategy(const Context& context,
-                    HypernodeID numNodes,
-                    FMSharedData& sharedData,
-                    FMStats& runStats) :
+  GainCacheStrategyT(const Context& context,
+                     HypernodeID numNodes,
+                     FMSharedData& sharedData,
+                     FMStats& runStats) :
       context(context),
       runStats(runStats),
       sharedData(sharedData),
       blockPQ(static_cast<size_t>(context.partition.k)),
       vertexPQs(static_cast<size_t>(context.partition.k),
-                VertexPriorityQueue(sharedData.vertexPQHandles.data(), numNodes))
+                createVertexPQ(numNodes, sharedData))
       { }
 
   template<typename PHG>
@@ -175,6 +179,15 @@ public:
 
 private:
 
+  static VertexPriorityQueue createVertexPQ(const HypernodeID numNodes,
+                                            FMSharedData& sharedData) {
+    if constexpr ( std::is_constructible<VertexPriorityQueue, PosT*, size_t, Gain>::value ) {
+      return VertexPriorityQueue(sharedData.vertexPQHandles.data(), numNodes,
+        sharedData.maxBucketGain);
+    } else {
+      return VertexPriorityQueue(sharedData.vertexPQHandles.data(), numNodes);
+    }
+  }
 
   MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
   void updatePQs() {
@@ -193,6 +206,31 @@ private:
                                                                  const HypernodeID u,
                                                                  const PartitionID from) {
     const HypernodeWeight wu = phg.nodeWeight(u);
+    if ( phg.k() == 2 ) {
+      // bisection: the only candidate is the other block (runtime dispatch, the
+      // gain cache has the same layout as for k-way partitioning)
+      const PartitionID to = 1 - from;
+      if ( phg.partWeight(to) + wu <= context.partition.max_part_weights[to] ) {
+        return std::make_pair(to, phg.moveToBenefit(u, to) - phg.moveFromPenalty(u));
+      }
+      return std::make_pair(kInvalidPartition, std::numeric_limits<HyperedgeWeight>::min());
+    }
+
+    if ( phg.k() <= target_block_selection::kMaxVectorizedBlocks ) {
+      // gather benefits and block weights into contiguous buffers and select the target with SIMD
+      alignas(64) Gain benefits[target_block_selection::kMaxVectorizedBlocks];
+      alignas(64) HypernodeWeight weights[target_block_selection::kMaxVectorizedBlocks];
+      for (PartitionID i = 0; i < phg.k(); ++i) {
+        benefits[i] = phg.moveToBenefit(u, i);
+        weights[i] = phg.partWeight(i);
+      }
+      const PartitionID to = target_block_selection::select(benefits, weights,
+        context.partition.max_part_weights.data(), phg.k(), from, wu);
+      const Gain gain = to != kInvalidPartition ? benefits[to] - phg.moveFromPenalty(u)
+                                                : std::numeric_limits<HyperedgeWeight>::min();
+      return std::make_pair(to, gain);
+    }
+
     const HypernodeWeight from_weight = phg.partWeight(from);
     PartitionID to = kInvalidPartition;
     HyperedgeWeight to_benefit = std::numeric_limits<HyperedgeWeight>::min();
@@ -260,4 +298,7 @@ private:
   vec<VertexPriorityQueue> vertexPQs;
 };
 
-}
\ No newline at end of file
+using GainCacheStrategy = GainCacheStrategyT< ds::MaxHeap<Gain, HypernodeID> >;
+using GainCacheBucketPQStrategy = GainCacheStrategyT< ds::BucketPriorityQueue<Gain, HypernodeID> >;
+
+}
@@ -27,6 +27,7 @@
 #pragma once
 
 #include "mt-kahypar/datastructures/hypergraph_common.h"
+#include "mt-kahypar/partition/refinement/fm/strategies/target_block_selection.h"
 
 namespace mt_kahypar {
 struct Km1GainComputer {
@@ -77,9 +78,57 @@ struct Km1GainComputer {
   std::pair<PartitionID, HyperedgeWeight> computeBestTargetBlock(const PHG& phg,
                                                                  const HypernodeID u,
                                                                  const std::vector<HypernodeWeight>& max_part_weights) {
+    if ( phg.k() == 2 ) {
+      return computeBestTargetBlockTwoWay(phg, u, max_part_weights);
+    }
+    return computeBestTargetBlockKWay(phg, u, max_part_weights);
+  }
+
+  // ! Bisection: the only candidate is the other block and the gain of a net only depends on
+  // ! the pin counts of both blocks. Neither connectivity sets nor the gains vector are touched.
+  // ! Note that k is still a runtime value, the partitioned hypergraph type is the same as for
+  // ! k-way partitioning (two counters per net share one word in PinCountInPart, see there).
+  template<typename PHG>
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
+  std::pair<PartitionID, HyperedgeWeight> computeBestTargetBlockTwoWay(const PHG& phg,
+                                                                       const HypernodeID u,
+                                                                       const std::vector<HypernodeWeight>& max_part_weights) const {
+    ASSERT(phg.k() == 2);
+    const PartitionID from = phg.partID(u);
+    const PartitionID to = 1 - from;
+    if ( phg.partWeight(to) + phg.nodeWeight(u) > max_part_weights[to] ) {
+      return std::make_pair(kInvalidPartition, std::numeric_limits<Gain>::min());
+    }
+    Gain gain = 0;
+    for (HyperedgeID e : phg.incidentEdges(u)) {
+      const Gain removes_from = phg.pinCountInPart(e, from) == 1;
+      const Gain adds_to = phg.pinCountInPart(e, to) == 0;
+      gain += phg.edgeWeight(e) * (removes_from - adds_to);
+    }
+    return std::make_pair(to, gain);
+  }
+
+  template<typename PHG>
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
+  std::pair<PartitionID, HyperedgeWeight> computeBestTargetBlockKWay(const PHG& phg,
+                                                                     const HypernodeID u,
+                                                                     const std::vector<HypernodeWeight>& max_part_weights) {
     const HypernodeWeight weight_of_u = phg.nodeWeight(u);
     const PartitionID from = phg.partID(u);
     const Gain internal_weight = computeGainsPlusInternalWeight(phg, u);
+    if ( phg.k() <= target_block_selection::kMaxVectorizedBlocks ) {
+      alignas(64) HypernodeWeight weights[target_block_selection::kMaxVectorizedBlocks];
+      for (PartitionID i = 0; i < phg.k(); ++i) {
+        weights[i] = phg.partWeight(i);
+      }
+      const PartitionID best_target = target_block_selection::select(gains.data(), weights,
+        max_part_weights.data(), phg.k(), from, weight_of_u);
+      const Gain best_gain = ( best_target != kInvalidPartition ? gains[best_target]
+                                                                : std::numeric_limits<Gain>::min() ) - internal_weight;
+      clear();
+      return std::make_pair(best_target, best_gain);
+    }
+
     PartitionID best_target = kInvalidPartition;
     HypernodeWeight best_target_weight = std::numeric_limits<HypernodeWeight>::max();
     Gain best_gain = std::numeric_limits<Gain>::min();
@@ -0,0 +1,231 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2021 Lars Gottesbüren <lars.gottesbueren@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include <limits>
+
+#include "mt-kahypar/macros.h"
+#include "mt-kahypar/datastructures/hypergraph_common.h"
+
+#ifdef MT_KAHYPAR_HAS_X86_SIMD_DISPATCH
+#include <immintrin.h>
+#endif
+
+namespace mt_kahypar {
+namespace target_block_selection {
+
+// ! Number of blocks up to which the target block of a move is selected with
+// ! SIMD instructions (one AVX-512 register or two AVX2 registers)
+static constexpr PartitionID kMaxVectorizedBlocks = 16;
+
+/*
+ * Selects the best target block of a node out of the k blocks of the partition.
+ * A block i != from is feasible if weights[i] + node_weight <= max_weights[i].
+ * Among all feasible blocks, the block with the highest benefit is selected.
+ * Ties are broken in favor of the lighter block and then in favor of the block
+ * with the smaller ID, which is exactly the order of the sequential scan used
+ * by the FM gain computers. Returns kInvalidPartition if no block is feasible.
+ */
+MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
+PartitionID selectScalar(const Gain* benefits,
+                         const HypernodeWeight* weights,
+                         const HypernodeWeight* max_weights,
+                         const PartitionID k,
+                         const PartitionID from,
+                         const HypernodeWeight node_weight) {
+  PartitionID best_block = kInvalidPartition;
+  Gain best_benefit = std::numeric_limits<Gain>::min();
+  HypernodeWeight best_weight = std::numeric_limits<HypernodeWeight>::max();
+  for ( PartitionID i = 0; i < k; ++i ) {
+    if ( i != from && weights[i] + node_weight <= max_weights[i] &&
+         ( best_block == kInvalidPartition || benefits[i] > best_benefit ||
+           ( benefits[i] == best_benefit && weights[i] < best_weight ) ) ) {
+      best_block = i;
+      best_benefit = benefits[i];
+      best_weight = weights[i];
+    }
+  }
+  return best_block;
+}
+
+#ifdef MT_KAHYPAR_HAS_X86_SIMD_DISPATCH
+namespace impl {
+
+MT_KAHYPAR_ATTRIBUTE_TARGET("avx2")
+inline int32_t horizontalMax(const __m256i v) {
+  __m128i m = _mm_max_epi32(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+  m = _mm_max_epi32(m, _mm_shuffle_epi32(m, _MM_SHUFFLE(1, 0, 3, 2)));
+  m = _mm_max_epi32(m, _mm_shuffle_epi32(m, _MM_SHUFFLE(2, 3, 0, 1)));
+  return _mm_cvtsi128_si32(m);
+}
+
+MT_KAHYPAR_ATTRIBUTE_TARGET("avx2")
+inline int32_t horizontalMin(const __m256i v) {
+  __m128i m = _mm_min_epi32(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+  m = _mm_min_epi32(m, _mm_shuffle_epi32(m, _MM_SHUFFLE(1, 0, 3, 2)));
+  m = _mm_min_epi32(m, _mm_shuffle_epi32(m, _MM_SHUFFLE(2, 3, 0, 1)));
+  return _mm_cvtsi128_si32(m);
+}
+
+MT_KAHYPAR_ATTRIBUTE_TARGET("avx2")
+inline uint32_t laneMask(const __m256i lo, const __m256i hi) {
+  return static_cast<uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(lo))) |
+         ( static_cast<uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(hi))) << 8 );
+}
+
+// ! Blocks 0..7 are processed in the low, blocks 8..15 in the high register
+MT_KAHYPAR_ATTRIBUTE_TARGET("avx2")
+inline PartitionID selectAVX2(const Gain* benefits,
+                              const HypernodeWeight* weights,
+                              const HypernodeWeight* max_weights,
+                              const PartitionID k,
+                              const PartitionID from,
+                              const HypernodeWeight node_weight) {
+  const __m256i idx_lo = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+  const __m256i idx_hi = _mm256_add_epi32(idx_lo, _mm256_set1_epi32(8));
+  const __m256i k_vec = _mm256_set1_epi32(k);
+  const __m256i from_vec = _mm256_set1_epi32(from);
+  const __m256i in_range_lo = _mm256_cmpgt_epi32(k_vec, idx_lo);
+  const __m256i in_range_hi = _mm256_cmpgt_epi32(k_vec, idx_hi);
+
+  // Masked loads never touch memory of blocks >= k
+  const __m256i b_lo = _mm256_maskload_epi32(benefits, in_range_lo);
+  const __m256i b_hi = _mm256_maskload_epi32(benefits + 8, in_range_hi);
+  const __m256i w_lo = _mm256_maskload_epi32(weights, in_range_lo);
+  const __m256i w_hi = _mm256_maskload_epi32(weights + 8, in_range_hi);
+  const __m256i max_lo = _mm256_maskload_epi32(max_weights, in_range_lo);
+  const __m256i max_hi = _mm256_maskload_epi32(max_weights + 8, in_range_hi);
+
+  const __m256i nw = _mm256_set1_epi32(node_weight);
+  const __m256i overloaded_lo = _mm256_or_si256(
+    _mm256_cmpgt_epi32(_mm256_add_epi32(w_lo, nw), max_lo), _mm256_cmpeq_epi32(idx_lo, from_vec));
+  const __m256i overloaded_hi = _mm256_or_si256(
+    _mm256_cmpgt_epi32(_mm256_add_epi32(w_hi, nw), max_hi), _mm256_cmpeq_epi32(idx_hi, from_vec));
+  const __m256i feasible_lo = _mm256_andnot_si256(overloaded_lo, in_range_lo);
+  const __m256i feasible_hi = _mm256_andnot_si256(overloaded_hi, in_range_hi);
+  if ( laneMask(feasible_lo, feasible_hi) == 0 ) {
+    return kInvalidPartition;
+  }
+
+  // Highest benefit among all feasible blocks
+  const __m256i min_gain = _mm256_set1_epi32(std::numeric_limits<Gain>::min());
+  const int32_t best_benefit = horizontalMax(_mm256_max_epi32(
+    _mm256_blendv_epi8(min_gain, b_lo, feasible_lo),
+    _mm256_blendv_epi8(min_gain, b_hi, feasible_hi)));
+  const __m256i best_benefit_vec = _mm256_set1_epi32(best_benefit);
+  const __m256i cand_lo = _mm256_and_si256(feasible_lo, _mm256_cmpeq_epi32(b_lo, best_benefit_vec));
+  const __m256i cand_hi = _mm256_and_si256(feasible_hi, _mm256_cmpeq_epi32(b_hi, best_benefit_vec));
+
+  // Lightest block among all blocks with the highest benefit
+  const __m256i max_weight = _mm256_set1_epi32(std::numeric_limits<HypernodeWeight>::max());
+  const int32_t best_weight = horizontalMin(_mm256_min_epi32(
+    _mm256_blendv_epi8(max_weight, w_lo, cand_lo),
+    _mm256_blendv_epi8(max_weight, w_hi, cand_hi)));
+  const __m256i best_weight_vec = _mm256_set1_epi32(best_weight);
+  const uint32_t best = laneMask(
+    _mm256_and_si256(cand_lo, _mm256_cmpeq_epi32(w_lo, best_weight_vec)),
+    _mm256_and_si256(cand_hi, _mm256_cmpeq_epi32(w_hi, best_weight_vec)));
+  return __builtin_ctz(best);
+}
+
+MT_KAHYPAR_ATTRIBUTE_TARGET("avx512f")
+inline PartitionID selectAVX512(const Gain* benefits,
+                                const HypernodeWeight* weights,
+                                const HypernodeWeight* max_weights,
+                                const PartitionID k,
+                                const PartitionID from,
+                                const HypernodeWeight node_weight) {
+  const __mmask16 in_range = static_cast<__mmask16>((1u << k) - 1);
+  const __mmask16 candidates = ( from >= 0 && from < k ) ?
+    static_cast<__mmask16>(in_range & ~(1u << from)) : in_range;
+  const __m512i b = _mm512_maskz_loadu_epi32(in_range, benefits);
+  const __m512i w = _mm512_maskz_loadu_epi32(in_range, weights);
+  const __m512i max = _mm512_maskz_loadu_epi32(in_range, max_weights);
+
+  const __mmask16 feasible = _mm512_mask_cmple_epi32_mask(
+    candidates, _mm512_add_epi32(w, _mm512_set1_epi32(node_weight)), max);
+  if ( feasible == 0 ) {
+    return kInvalidPartition;
+  }
+  const int32_t best_benefit = _mm512_mask_reduce_max_epi32(feasible, b);
+  const __mmask16 cand = _mm512_mask_cmpeq_epi32_mask(feasible, b, _mm512_set1_epi32(best_benefit));
+  const int32_t best_weight = _mm512_mask_reduce_min_epi32(cand, w);
+  const __mmask16 best = _mm512_mask_cmpeq_epi32_mask(cand, w, _mm512_set1_epi32(best_weight));
+  return __builtin_ctz(static_cast<uint32_t>(best));
+}
+
+enum class InstructionSet : uint8_t { scalar, avx2, avx512 };
+
+inline InstructionSet detectInstructionSet() {
+  #if defined(__AVX512F__)
+  return InstructionSet::avx512;
+  #elif defined(__AVX2__)
+  return InstructionSet::avx2;
+  #else
+  static const InstructionSet isa = [] {
+    __builtin_cpu_init();
+    if ( __builtin_cpu_supports("avx512f") ) return InstructionSet::avx512;
+    if ( __builtin_cpu_supports("avx2") ) return InstructionSet::avx2;
+    return InstructionSet::scalar;
+  }();
+  return isa;
+  #endif
+}
+
+} // namespace impl
+#endif
+
+/*
+ * Same as selectScalar(...), but uses AVX-512 or AVX2 if k <= kMaxVectorizedBlocks
+ * and the CPU supports it. If the binary is compiled with -march=native (release
+ * builds), the instruction set is fixed at compile time. Otherwise, it is
+ * detected once at runtime.
+ */
+MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
+PartitionID select(const Gain* benefits,
+                   const HypernodeWeight* weights,
+                   const HypernodeWeight* max_weights,
+                   const PartitionID k,
+                   const PartitionID from,
+                   const HypernodeWeight node_weight) {
+  #ifdef MT_KAHYPAR_HAS_X86_SIMD_DISPATCH
+  if ( k <= kMaxVectorizedBlocks ) {
+    switch ( impl::detectInstructionSet() ) {
+      case impl::InstructionSet::avx512:
+        return impl::selectAVX512(benefits, weights, max_weights, k, from, node_weight);
+      case impl::InstructionSet::avx2:
+        return impl::selectAVX2(benefits, weights, max_weights, k, from, node_weight);
+      case impl::InstructionSet::scalar:
+        break;
+    }
+  }
+  #endif
+  return selectScalar(benefits, weights, max_weights, k, from, node_weight);
+}
+
+} // namespace target_block_selection
+} // namespace mt_kahypar
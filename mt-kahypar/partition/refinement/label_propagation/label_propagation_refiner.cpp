@@ -27,7 +27,10 @@
 
 #include "mt-kahypar/partition/refinement/label_propagation/label_propagation_refiner.h"
 
+#include <numeric>
+
 #include "tbb/parallel_for.h"
+#include "tbb/parallel_sort.h"
 
 #include "mt-kahypar/partition/metrics.h"
 #include "mt-kahypar/utils/randomize.h"
@@ -130,6 +133,8 @@ namespace mt_kahypar {
           converged = false;
         }
       }
+    } else if ( _context.refinement.label_propagation.cache_block_size > 0 ) {
+      converged = cacheBlockedLabelPropagationRound(hypergraph, next_active_nodes, objective_delta);
     } else {
       utils::Randomize::instance().parallelShuffleVector(
               _active_nodes, 0UL, _active_nodes.size());
@@ -167,6 +172,50 @@ namespace mt_kahypar {
     return converged;
   }
 
+  template <template <typename> class GainPolicy>
+  template <typename F>
+  bool LabelPropagationRefiner<GainPolicy>::cacheBlockedLabelPropagationRound(
+                              PartitionedHypergraph& hypergraph,
+                              NextActiveNodes& next_active_nodes,
+                              const F& objective_delta) {
+    // Consecutive active nodes are likely to share incident nets (e.g., for netlists
+    // whose node IDs follow the placement or after a locality-preserving reordering).
+    // Thus, we process the active nodes sorted by ID in blocks of consecutive nodes.
+    // Randomization is performed on the order of the blocks. While evaluating a node,
+    // we prefetch the pin counts of the nets of the next node in its block. Neighbors of
+    // moved nodes are activated after the block is processed, such that the pins of
+    // the activated nets do not evict the partition information of the block.
+    tbb::parallel_sort(_active_nodes.begin(), _active_nodes.end());
+    const size_t block_size = _context.refinement.label_propagation.cache_block_size;
+    const size_t num_blocks = ( _active_nodes.size() + block_size - 1 ) / block_size;
+    vec<size_t> blocks(num_blocks);
+    std::iota(blocks.begin(), blocks.end(), 0UL);
+    utils::Randomize::instance().shuffleVector(blocks, 0UL, num_blocks, sched_getcpu());
+
+    bool converged = true;
+    tbb::parallel_for(0UL, num_blocks, [&](const size_t i) {
+      vec<HypernodeID>& deferred_activations = _deferred_activations.local();
+      deferred_activations.clear();
+      const size_t start = blocks[i] * block_size;
+      const size_t end = std::min(start + block_size, _active_nodes.size());
+      for ( size_t j = start; j < end; ++j ) {
+        if ( j + 1 < end ) {
+          hypergraph.prefetchIncidentPartitionInfo(_active_nodes[j + 1]);
+        }
+        const HypernodeID hn = _active_nodes[j];
+        if ( moveVertex(hypergraph, hn, next_active_nodes, objective_delta, &deferred_activations) ) {
+          _active_node_was_moved[j] = uint8_t(true);
+        } else {
+          converged = false;
+        }
+      }
+      for ( const HypernodeID& hn : deferred_activations ) {
+        activateNeighbors(hypergraph, hn, next_active_nodes);
+      }
+    });
+    return converged;
+  }
+
   template <template <typename> class GainPolicy>
   void LabelPropagationRefiner<GainPolicy>::initializeImpl(PartitionedHypergraph& hypergraph) {
     ActiveNodes tmp_active_nodes;
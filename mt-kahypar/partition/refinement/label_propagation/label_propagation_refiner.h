@@ -27,6 +27,8 @@
 
 #pragma once
 
+#include "tbb/enumerable_thread_specific.h"
+
 #include "kahypar/datastructure/fast_reset_flag_array.h"
 
 #include "mt-kahypar/datastructures/streaming_vector.h"
@@ -58,7 +60,8 @@ class LabelPropagationRefiner final : public IRefiner {
     _active_nodes(),
     _active_node_was_moved(hypergraph.initialNumNodes(), uint8_t(false)),
     _next_active(hypergraph.initialNumNodes()),
-    _visited_he(hypergraph.initialNumEdges()) { }
+    _visited_he(hypergraph.initialNumEdges()),
+    _deferred_activations() { }
 
   LabelPropagationRefiner(const LabelPropagationRefiner&) = delete;
   LabelPropagationRefiner(LabelPropagationRefiner&&) = delete;
@@ -77,11 +80,21 @@ class LabelPropagationRefiner final : public IRefiner {
 
   bool labelPropagationRound(PartitionedHypergraph& hypergraph, NextActiveNodes& next_active_nodes);
 
+  // ! Processes the active nodes sorted by ID in blocks of consecutive nodes
+  // ! (see LabelPropagationParameters::cache_block_size)
+  template<typename F>
+  bool cacheBlockedLabelPropagationRound(PartitionedHypergraph& hypergraph,
+                                         NextActiveNodes& next_active_nodes,
+                                         const F& objective_delta);
+
+  // ! If deferred_activations is not a nullptr, the neighbors of a moved vertex
+  // ! are not activated immediately. Instead, the vertex is appended to deferred_activations.
   template<typename F>
   bool moveVertex(PartitionedHypergraph& hypergraph,
                   const HypernodeID hn,
                   NextActiveNodes& next_active_nodes,
-                  const F& objective_delta) {
+                  const F& objective_delta,
+                  vec<HypernodeID>* deferred_activations = nullptr) {
     bool is_moved = false;
     ASSERT(hn != kInvalidHypernode);
     if ( hypergraph.isBorderNode(hn) ) {
@@ -115,22 +128,10 @@ class LabelPropagationRefiner final : public IRefiner {
             DBG << "Move hypernode" << hn << "from block" << from << "to block" << to
                 << "with gain" << best_move.gain << "( Real Gain: " << move_delta << ")";
 
-            // Set all neighbors of the vertex to active
-            for (const HyperedgeID& he : hypergraph.incidentEdges(hn)) {
-              if ( hypergraph.edgeSize(he) <=
-                    ID(_context.refinement.label_propagation.hyperedge_size_activation_threshold) ) {
-                if ( !_visited_he[he] ) {
-                  for (const HypernodeID& pin : hypergraph.pins(he)) {
-                    if ( _next_active.compare_and_set_to_true(pin) ) {
-                      next_active_nodes.stream(pin);
-                    }
-                  }
-                  _visited_he.set(he, true);
-                }
-              }
-            }
-            if ( _next_active.compare_and_set_to_true(hn) ) {
-              next_active_nodes.stream(hn);
+            if ( deferred_activations ) {
+              deferred_activations->push_back(hn);
+            } else {
+              activateNeighbors(hypergraph, hn, next_active_nodes);
             }
           } else {
             DBG << "Revert move of hypernode" << hn << "from block" << from << "to block" << to
@@ -147,6 +148,28 @@ class LabelPropagationRefiner final : public IRefiner {
     return is_moved;
   }
 
+  // ! Set all neighbors of the vertex to active
+  void activateNeighbors(const PartitionedHypergraph& hypergraph,
+                         const HypernodeID hn,
+                         NextActiveNodes& next_active_nodes) {
+    for (const HyperedgeID& he : hypergraph.incidentEdges(hn)) {
+      if ( hypergraph.edgeSize(he) <=
+            ID(_context.refinement.label_propagation.hyperedge_size_activation_threshold) ) {
+        if ( !_visited_he[he] ) {
+          for (const HypernodeID& pin : hypergraph.pins(he)) {
+            if ( _next_active.compare_and_set_to_true(pin) ) {
+              next_active_nodes.stream(pin);
+            }
+          }
+          _visited_he.set(he, true);
+        }
+      }
+    }
+    if ( _next_active.compare_and_set_to_true(hn) ) {
+      next_active_nodes.stream(hn);
+    }
+  }
+
   void initializeActiveNodes(PartitionedHypergraph& hypergraph,
                              const parallel::scalable_vector<HypernodeID>& refinement_nodes);
 
@@ -177,6 +200,8 @@ class LabelPropagationRefiner final : public IRefiner {
   parallel::scalable_vector<uint8_t> _active_node_was_moved;
   ds::ThreadSafeFastResetFlagArray<> _next_active;
   kahypar::ds::FastResetFlagArray<> _visited_he;
+  // ! Moved vertices of the current block in the cache-blocked mode
+  tbb::enumerable_thread_specific<vec<HypernodeID>> _deferred_activations;
 };
 
 using LabelPropagationKm1Refiner = LabelPropagationRefiner<Km1Policy>;
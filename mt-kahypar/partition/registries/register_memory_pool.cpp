@@ -30,6 +30,7 @@
 #include "mt-kahypar/datastructures/pin_count_in_part.h"
 #include "mt-kahypar/datastructures/connectivity_set.h"
 #include "mt-kahypar/parallel/memory_pool.h"
+#include "mt-kahypar/partition/memory_budget.h"
 #include "mt-kahypar/parallel/atomic_wrapper.h"
 #include "mt-kahypar/utils/memory_tree.h"
 #include "mt-kahypar/utils/utilities.h"
@@ -37,7 +38,10 @@
 namespace mt_kahypar {
 
   void register_memory_pool(const Hypergraph& hypergraph,
-                            const Context& context) {
+                            const Context& input_context) {
+    // The partitioner applies the same adjustments to its context when it is set up
+    Context context(input_context);
+    memory_budget::enforceMemoryBudget(hypergraph, context);
 
     if (context.partition.mode == Mode::direct) {
 
@@ -55,8 +59,11 @@ namespace mt_kahypar {
         const size_t num_star_expansion_edges = is_graph ? num_pins : (2UL * num_pins);
 
         pool.register_memory_group("Preprocessing", 1);
-        pool.register_memory_chunk("Preprocessing", "indices", num_star_expansion_nodes + 1, sizeof(size_t));
-        pool.register_memory_chunk("Preprocessing", "arcs", num_star_expansion_edges, sizeof(Arc));
+        // The implicit star expansion only stores its node volumes
+        if ( is_graph || !context.preprocessing.community_detection.implicit_star_expansion ) {
+          pool.register_memory_chunk("Preprocessing", "indices", num_star_expansion_nodes + 1, sizeof(size_t));
+          pool.register_memory_chunk("Preprocessing", "arcs", num_star_expansion_edges, sizeof(Arc));
+        }
         pool.register_memory_chunk("Preprocessing", "node_volumes", num_star_expansion_nodes, sizeof(ArcWeight));
 
         if ( !context.preprocessing.community_detection.low_memory_contraction ) {
@@ -122,13 +129,12 @@ namespace mt_kahypar {
         pool.register_memory_chunk("Refinement", "connectivity_set",
                                   ds::ConnectivitySets::num_elements(num_hyperedges, context.partition.k),
                                   sizeof(ds::ConnectivitySets::UnsafeBlock));
-        if ( context.refinement.fm.algorithm != FMAlgorithm::do_nothing ) {
+        if ( context.refinement.fm.algorithm == FMAlgorithm::fm_gain_cache ||
+             context.refinement.fm.algorithm == FMAlgorithm::fm_gain_cache_on_demand ) {
           pool.register_memory_chunk("Refinement", "gain_cache",
                                     static_cast<size_t>(num_hypernodes) * ( context.partition.k + 1 ),
                                     sizeof(CAtomic<HyperedgeWeight>));
         }
-        pool.register_memory_chunk("Refinement", "pin_count_update_ownership",
-                                  num_hyperedges, sizeof(SpinLock));
       }
 
       // Allocate Memory
@@ -25,6 +25,8 @@
  * SOFTWARE.
  ******************************************************************************/
 
+#include <tbb/enumerable_thread_specific.h>
+
 #include "kahypar/meta/registrar.h"
 #include "mt-kahypar/partition/context.h"
 
@@ -34,6 +36,7 @@
 #include "mt-kahypar/partition/refinement/flows/flow_refiner.h"
 #include "mt-kahypar/partition/refinement/label_propagation/label_propagation_refiner.h"
 #include "mt-kahypar/partition/refinement/deterministic/deterministic_label_propagation.h"
+#include "mt-kahypar/partition/refinement/deterministic/deterministic_multitry_fm.h"
 #include "mt-kahypar/partition/refinement/fm/multitry_kway_fm.h"
 #include "mt-kahypar/partition/refinement/fm/strategies/gain_cache_strategy.h"
 #include "mt-kahypar/partition/refinement/fm/strategies/gain_delta_strategy.h"
@@ -68,13 +71,37 @@ REGISTER_LP_REFINER(LabelPropagationAlgorithm::deterministic, DeterministicLabel
 REGISTER_LP_REFINER(LabelPropagationAlgorithm::do_nothing, DoNothingRefiner, 1);
 
 using MultiTryKWayFMWithGainGache = MultiTryKWayFM<GainCacheStrategy>;
+using MultiTryKWayFMWithGainGacheBucketPQ = MultiTryKWayFM<GainCacheBucketPQStrategy>;
 using MultiTryKWayFMWithGainGacheOnDemand = MultiTryKWayFM<GainCacheOnDemandStrategy>;
 using MultiTryKWayFMWithGainDelta = MultiTryKWayFM<GainDeltaStrategy>;
 using MultiTryKWayFMWithGainRecomputation = MultiTryKWayFM<RecomputeGainStrategy>;
-REGISTER_FM_REFINER(FMAlgorithm::fm_gain_cache, MultiTryKWayFMWithGainGache, FMWithGainCache);
+// Uses bucket queues, if the gain of each move (bounded by the maximum weighted degree)
+// is within the configured gain range. The buckets cover the maximum weighted degree.
+static kahypar::meta::Registrar<FMFactory> register_MultiTryKWayFMWithGainGache(
+  FMAlgorithm::fm_gain_cache,
+  [](Hypergraph& hypergraph, const Context& context) -> IRefiner* {
+    const Gain gain_range = context.refinement.fm.bucket_pq_gain_range;
+    if ( gain_range > 0 ) {
+      tbb::enumerable_thread_specific<int64_t> max_weighted_degree(0);
+      hypergraph.doParallelForAllNodes([&](const HypernodeID& hn) {
+        int64_t weighted_degree = 0;
+        for ( const HyperedgeID& he : hypergraph.incidentEdges(hn) ) {
+          weighted_degree += hypergraph.edgeWeight(he);
+        }
+        max_weighted_degree.local() = std::max(max_weighted_degree.local(), weighted_degree);
+      });
+      const int64_t max_gain = max_weighted_degree.combine(
+        [](const int64_t lhs, const int64_t rhs) { return std::max(lhs, rhs); });
+      if ( max_gain <= gain_range ) {
+        return new MultiTryKWayFMWithGainGacheBucketPQ(hypergraph, context, static_cast<Gain>(max_gain));
+      }
+    }
+    return new MultiTryKWayFMWithGainGache(hypergraph, context);
+  });
 REGISTER_FM_REFINER(FMAlgorithm::fm_gain_cache_on_demand, MultiTryKWayFMWithGainGacheOnDemand, FMWithGainCacheOnDemand);
 REGISTER_FM_REFINER(FMAlgorithm::fm_gain_delta, MultiTryKWayFMWithGainDelta, FMWithGainDelta);
 REGISTER_FM_REFINER(FMAlgorithm::fm_recompute_gain, MultiTryKWayFMWithGainRecomputation, FMWithGainRecomputation);
+REGISTER_FM_REFINER(FMAlgorithm::deterministic, DeterministicMultiTryFM, Deterministic);
 REGISTER_FM_REFINER(FMAlgorithm::do_nothing, DoNothingRefiner, 2);
 
 REGISTER_FLOW_REFINER(FlowAlgorithm::do_nothing, DoNothingFlowRefiner, 3);
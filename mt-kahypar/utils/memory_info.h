@@ -0,0 +1,70 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2021 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <fstream>
+#include <limits>
+#include <string>
+
+namespace mt_kahypar::utils {
+
+// ! Memory limit of the cgroup of the process in bytes (cgroup v2 or v1).
+// ! Returns std::numeric_limits<size_t>::max(), if there is no limit.
+inline size_t cgroupMemoryLimit() {
+  for ( const char* filename : { "/sys/fs/cgroup/memory.max",
+                                 "/sys/fs/cgroup/memory/memory.limit_in_bytes" } ) {
+    std::ifstream file(filename);
+    std::string limit;
+    if ( file >> limit ) {
+      // cgroup v2 reports 'max' and cgroup v1 a huge number, if there is no limit
+      try {
+        return limit == "max" ? std::numeric_limits<size_t>::max() : std::stoull(limit);
+      } catch ( const std::exception& ) { }
+    }
+  }
+  return std::numeric_limits<size_t>::max();
+}
+
+// ! Size of the physical memory of the machine in bytes, which is
+// ! bounded by the memory limit of the cgroup of the process
+inline size_t physicalMemory() {
+  const long num_pages = sysconf(_SC_PHYS_PAGES);
+  const long page_size = sysconf(_SC_PAGE_SIZE);
+  if ( num_pages <= 0 || page_size <= 0 ) {
+    // Fallback, if the size of the physical memory can not be determined
+    return std::min(16UL * (1UL << 30), cgroupMemoryLimit());
+  }
+  return std::min(static_cast<size_t>(num_pages) * static_cast<size_t>(page_size),
+                  cgroupMemoryLimit());
+}
+
+}  // namespace mt_kahypar::utils
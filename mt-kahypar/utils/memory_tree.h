@@ -52,6 +52,11 @@ class MemoryTreeNode {
     _size_in_bytes += delta;
   }
 
+  // ! Size of the node (includes the size of all children after finalize())
+  size_t size_in_bytes() const {
+    return _size_in_bytes;
+  }
+
   void finalize();
 
  private:
@@ -80,20 +80,20 @@ private:
 };
 
 
+// ! The random buckets are drawn from one RNG stream per block of block_size
+// ! consecutive elements. The assignment therefore only depends on the seed and
+// ! on n, but not on the number of tasks (or threads) used to compute it.
 struct PrecomputeBucket {
-  void compute_buckets(size_t n, size_t num_tasks, uint32_t seed) {
+  void compute_buckets(size_t n, size_t /*num_tasks*/, uint32_t seed) {
     if (n > precomputed_buckets.size()) {
       precomputed_buckets.resize(n);
     }
 
-    const size_t chunk_size = parallel::chunking::idiv_ceil(n, num_tasks);
-
-    tbb::parallel_for(0UL, num_tasks, [&](size_t i) {
-      std::mt19937 rng(seed);
-      rng.discard(i);
-      rng.seed(rng());
+    const size_t num_blocks = parallel::chunking::idiv_ceil(n, block_size);
+    tbb::parallel_for(0UL, num_blocks, [&](size_t i) {
+      std::mt19937 rng(static_cast<uint32_t>(seed_iteration(seed, i)));
 
-      auto [begin, end] = parallel::chunking::bounds(i, n, chunk_size);
+      auto [begin, end] = parallel::chunking::bounds(i, n, block_size);
       assert(begin < end);
       for (size_t j = begin; j < end; ++j) {
         precomputed_buckets[j] = static_cast<uint8_t>(rng());
@@ -105,30 +105,25 @@ struct PrecomputeBucket {
     return precomputed_buckets[i];
   }
 
+  static constexpr size_t block_size = 1UL << 12;
   vec<uint8_t> precomputed_buckets;
 };
 
 // optimized version of PrecomputeBucket that uses all 32 bits of the rng call
 struct PrecomputeBucketOpt {
-  void compute_buckets(size_t n, size_t num_tasks, uint32_t seed) {
+  void compute_buckets(size_t n, size_t /*num_tasks*/, uint32_t seed) {
     if (n > precomputed_buckets.size()) {
       precomputed_buckets.resize(n);
     }
 
-    size_t chunk_size = parallel::chunking::idiv_ceil(n, num_tasks);
-    if (chunk_size % 4 != 0) {
-      chunk_size += 4 - (chunk_size % 4); // round up to multiple of 4 --> only last range has to do the overhang bit
-    }
-    assert(chunk_size % 4 == 0);
-    size_t num_tasks_needed = parallel::chunking::idiv_ceil(n, chunk_size);
+    // block size is a multiple of 4 --> only last range has to do the overhang bit
+    static_assert(block_size % 4 == 0);
+    const size_t num_blocks = parallel::chunking::idiv_ceil(n, block_size);
 
-    tbb::parallel_for(0UL, num_tasks_needed, [&](size_t i) {
-      std::mt19937 rng(seed);
-      rng.discard(i);
-      size_t local_seed = rng();
-      rng.seed(local_seed);
+    tbb::parallel_for(0UL, num_blocks, [&](size_t i) {
+      std::mt19937 rng(static_cast<uint32_t>(seed_iteration(seed, i)));
 
-      auto [begin, end] = parallel::chunking::bounds(i, n, chunk_size);
+      auto [begin, end] = parallel::chunking::bounds(i, n, block_size);
       assert(begin < end);
       size_t overhang = end % 4;
       size_t truncated_end = end - overhang;
@@ -153,6 +148,7 @@ struct PrecomputeBucketOpt {
   }
 
   static constexpr uint32_t mask = (1 << 8) - 1;
+  static constexpr size_t block_size = 1UL << 12;
   vec<uint8_t> precomputed_buckets;
 };
 
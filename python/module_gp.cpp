@@ -262,7 +262,23 @@ Construct a weighted graph.
           f(graph.edgeTarget(he));
         }
       }, "Executes lambda expression for all adjacent nodes of a node",
-      py::arg("node"), py::arg("lambda expression"));
+      py::arg("node"), py::arg("lambda expression"))
+    .def("setCommunityIDs", [](Graph& graph, const std::vector<mt_kahypar::PartitionID>& community_ids) {
+        if ( community_ids.size() != graph.initialNumNodes() ) {
+          throw py::value_error("Number of community IDs (" + std::to_string(community_ids.size()) +
+            ") does not match the number of nodes (" + std::to_string(graph.initialNumNodes()) + ")");
+        }
+        mt_kahypar::ds::Clustering communities(community_ids.begin(), community_ids.end());
+        graph.setCommunityIDs(std::move(communities));
+      }, "Sets the community ID of each node (only used for partitioning if usePrecomputedCommunities is set)",
+      py::arg("community IDs"))
+    .def("communityIDs", [](const Graph& graph) {
+        std::vector<mt_kahypar::PartitionID> community_ids(graph.initialNumNodes());
+        for ( const HypernodeID& hn : graph.nodes() ) {
+          community_ids[hn] = graph.communityID(hn);
+        }
+        return community_ids;
+      }, "Community ID of each node (computed during preprocessing of a previous partitioning call)");
 
   // ####################### Partitioned Hypergraph #######################
 
@@ -431,6 +447,15 @@ Construct a partitioned graph.
         context.partition.verbose_output = verbose;
       }, "Enable partitioning output",
       py::arg("bool"))
+    .def("usePrecomputedCommunities", [](Context& context, const bool use_precomputed_communities) {
+        context.preprocessing.use_precomputed_communities = use_precomputed_communities;
+      }, "Skip community detection and use the community IDs of the input instead",
+      py::arg("bool"))
+    .def("setCommunityCacheFile", [](Context& context, const std::string& cache_file) {
+        context.preprocessing.cache_communities = true;
+        context.partition.graph_community_cache_filename = cache_file;
+      }, "Communities are read from (or written to, if not present) the given file",
+      py::arg("path to community cache file"))
     .def("outputConfiguration", [](const Context& context) {
         LOG << context;
       }, "Output partitioning configuration");
@@ -252,7 +252,23 @@ Construct a weighted hypergraph.
           f(hn);
         }
       }, "Executes lambda expression for all pins of a hyperedge",
-      py::arg("hyperedge"), py::arg("lambda expression"));
+      py::arg("hyperedge"), py::arg("lambda expression"))
+    .def("setCommunityIDs", [](Hypergraph& hypergraph, const std::vector<mt_kahypar::PartitionID>& community_ids) {
+        if ( community_ids.size() != hypergraph.initialNumNodes() ) {
+          throw py::value_error("Number of community IDs (" + std::to_string(community_ids.size()) +
+            ") does not match the number of nodes (" + std::to_string(hypergraph.initialNumNodes()) + ")");
+        }
+        mt_kahypar::ds::Clustering communities(community_ids.begin(), community_ids.end());
+        hypergraph.setCommunityIDs(std::move(communities));
+      }, "Sets the community ID of each node (only used for partitioning if usePrecomputedCommunities is set)",
+      py::arg("community IDs"))
+    .def("communityIDs", [](const Hypergraph& hypergraph) {
+        std::vector<mt_kahypar::PartitionID> community_ids(hypergraph.initialNumNodes());
+        for ( const HypernodeID& hn : hypergraph.nodes() ) {
+          community_ids[hn] = hypergraph.communityID(hn);
+        }
+        return community_ids;
+      }, "Community ID of each node (computed during preprocessing of a previous partitioning call)");
 
   // ####################### Partitioned Hypergraph #######################
 
@@ -432,6 +448,15 @@ Construct a partitioned hypergraph.
         context.partition.verbose_output = verbose;
       }, "Enable partitioning output",
       py::arg("bool"))
+    .def("usePrecomputedCommunities", [](Context& context, const bool use_precomputed_communities) {
+        context.preprocessing.use_precomputed_communities = use_precomputed_communities;
+      }, "Skip community detection and use the community IDs of the input instead",
+      py::arg("bool"))
+    .def("setCommunityCacheFile", [](Context& context, const std::string& cache_file) {
+        context.preprocessing.cache_communities = true;
+        context.partition.graph_community_cache_filename = cache_file;
+      }, "Communities are read from (or written to, if not present) the given file",
+      py::arg("path to community cache file"))
     .def("outputConfiguration", [](const Context& context) {
         LOG << context;
       }, "Output partitioning configuration");
@@ -123,6 +123,14 @@ class MainTest(unittest.TestCase):
     self.assertEqual(graph.target(11), 3) # (4,3)
 
 
+  def test_set_community_ids(self):
+    graph = gp.Graph(5, 6, [(0,1),(0,2),(1,2),(1,3),(2,3),(3,4)])
+
+    graph.setCommunityIDs([0,0,0,1,1])
+    self.assertEqual(graph.communityIDs(), [0,0,0,1,1])
+    with self.assertRaises(ValueError):
+      graph.setCommunityIDs([0,0,0,1,1,1])
+
   def test_load_graph_in_metis_file_format(self):
     graph = gp.Graph(
       mydir + "/test_instances/delaunay_n15.graph", gp.FileFormat.METIS)
@@ -90,6 +90,14 @@ class MainTest(unittest.TestCase):
     self.assertEqual(hypergraph.edgeWeight(2), 3)
     self.assertEqual(hypergraph.edgeWeight(3), 4)
 
+  def test_set_community_ids(self):
+    hypergraph = hgp.Hypergraph(7, 4, [[0,2],[0,1,3,4],[3,4,6],[2,5,6]])
+
+    hypergraph.setCommunityIDs([0,0,1,1,1,2,2])
+    self.assertEqual(hypergraph.communityIDs(), [0,0,1,1,1,2,2])
+    with self.assertRaises(ValueError):
+      hypergraph.setCommunityIDs([0,0,1])
+
   def test_load_hypergraph_in_hmetis_file_format(self):
     hypergraph = hgp.Hypergraph(
       mydir + "/test_instances/ibm01.hgr", hgp.FileFormat.HMETIS)
@@ -188,5 +188,25 @@ TEST_F(ADeltaPartitionedHypergraph, MovesSeveralVertices) {
   verifymoveToBenefit(6, { 0, 2, 0 });
 }
 
+TEST_F(ADeltaPartitionedHypergraph, ResetsMemory) {
+  const size_t initial_memory = delta_phg.combinedMemoryConsumption();
+  delta_phg.changeNodePartWithGainCacheUpdate(6, 2, 1, 1000);
+  delta_phg.changeNodePartWithGainCacheUpdate(2, 0, 1, 1000);
+  ASSERT_EQ(1, delta_phg.partID(2));
+  ASSERT_EQ(1, delta_phg.partID(6));
+
+  delta_phg.resetMemory();
+  ASSERT_EQ(initial_memory, delta_phg.combinedMemoryConsumption());
+  ASSERT_EQ(0, delta_phg.partID(2));
+  ASSERT_EQ(2, delta_phg.partID(6));
+  ASSERT_EQ(phg.partWeight(1), delta_phg.partWeight(1));
+  verifyPinCounts(3, { 1, 0, 2 });
+
+  // delta partition is still usable
+  delta_phg.changeNodePartWithGainCacheUpdate(5, 2, 1, 1000);
+  ASSERT_EQ(1, delta_phg.partID(5));
+  verifyPinCounts(3, { 1, 1, 1 });
+}
+
 } // namespace ds
 } // namespace mt_kahypar
\ No newline at end of file
@@ -24,6 +24,7 @@
  * SOFTWARE.
  ******************************************************************************/
 
+#include <algorithm>
 #include <functional>
 #include <random>
 
@@ -80,6 +81,45 @@ TEST(GainUpdates, Example1) {
   ASSERT_EQ(phg.km1Gain(6, 0, 1), 0);
 }
 
+TEST(GainUpdates, IgnoresLargeHyperedgesInGainCache) {
+  Hypergraph hg = io::readHypergraphFile("../tests/instances/contracted_ibm01.hgr", 0);
+  const PartitionID k = 4;
+  const HypernodeID large_hyperedge_threshold = 10;
+  mt_kahypar::PartitionedHypergraph phg(k, hg);
+  ASSERT_TRUE(std::any_of(hg.edges().begin(), hg.edges().end(), [&](const HyperedgeID he) {
+    return hg.edgeSize(he) > large_hyperedge_threshold;
+  }));
+
+  std::mt19937 rng(42);
+  std::uniform_int_distribution<PartitionID> block_dist(0, k - 1);
+  for (const HypernodeID& u : hg.nodes()) {
+    phg.setNodePart(u, block_dist(rng));
+  }
+  phg.initializeGainCache(large_hyperedge_threshold);
+  ASSERT_TRUE(phg.checkTrackedPartitionInformation());
+
+  for (const HypernodeID& u : hg.nodes()) {
+    if (u % 3 == 0) {
+      const PartitionID from = phg.partID(u);
+      const PartitionID to = (from + 1) % k;
+      phg.changeNodePartWithGainCacheUpdate(u, from, to);
+      phg.recomputeMoveFromPenalty(u);
+    }
+  }
+
+  // gain cache entries do not contain large hyperedges, but pin counts are exact
+  ASSERT_TRUE(phg.checkTrackedPartitionInformation());
+  for (const HyperedgeID& he : hg.edges()) {
+    if (phg.isLargeHyperedge(he)) {
+      HypernodeID pin_count = 0;
+      for (PartitionID block = 0; block < k; ++block) {
+        pin_count += phg.pinCountInPart(he, block);
+      }
+      ASSERT_EQ(hg.edgeSize(he), pin_count);
+    }
+  }
+}
+
 
 }  // namespace ds
 }  // namespace mt_kahypar
@@ -29,6 +29,7 @@
 #include "tests/datastructures/hypergraph_fixtures.h"
 #include "mt-kahypar/definitions.h"
 #include "mt-kahypar/datastructures/graph.h"
+#include "mt-kahypar/datastructures/star_expansion_graph.h"
 
 using ::testing::Test;
 
@@ -357,4 +358,81 @@ TEST_F(AGraph, HasSameTotalVolumeAfterTwoContractions) {
   ASSERT_EQ(6,  coarse_coarse_graph.nodeVolume(2));
 }
 
+void verifyStarExpansion(const Graph& graph, const StarExpansionGraph& star_expansion) {
+  ASSERT_EQ(graph.numNodes(), star_expansion.numNodes());
+  ASSERT_EQ(graph.numArcs(), star_expansion.numArcs());
+  ASSERT_EQ(graph.max_degree(), star_expansion.max_degree());
+  ASSERT_EQ(graph.totalVolume(), star_expansion.totalVolume());
+  for ( const NodeID& u : graph.nodes() ) {
+    ASSERT_EQ(graph.degree(u), star_expansion.degree(u));
+    ASSERT_EQ(graph.nodeVolume(u), star_expansion.nodeVolume(u));
+    std::vector<NodeID> heads;
+    std::vector<ArcWeight> weights;
+    for ( const Arc& arc : graph.arcsOf(u) ) {
+      heads.push_back(arc.head);
+      weights.push_back(arc.weight);
+    }
+    size_t pos = 0;
+    for ( const Arc& arc : star_expansion.arcsOf(u) ) {
+      ASSERT_LT(pos, heads.size());
+      ASSERT_EQ(heads[pos], arc.head);
+      ASSERT_EQ(weights[pos], arc.weight);
+      ++pos;
+    }
+    ASSERT_EQ(heads.size(), pos);
+  }
+}
+
+TEST_F(AGraph, HasSameArcsAsImplicitStarExpansionForUniformEdgeWeight) {
+  Graph graph(hypergraph, LouvainEdgeWeight::uniform);
+  StarExpansionGraph star_expansion(hypergraph, LouvainEdgeWeight::uniform);
+  verifyStarExpansion(graph, star_expansion);
+}
+
+TEST_F(AGraph, HasSameArcsAsImplicitStarExpansionForNonUniformEdgeWeight) {
+  Graph graph(hypergraph, LouvainEdgeWeight::non_uniform);
+  StarExpansionGraph star_expansion(hypergraph, LouvainEdgeWeight::non_uniform);
+  verifyStarExpansion(graph, star_expansion);
+}
+
+TEST_F(AGraph, HasSameArcsAsImplicitStarExpansionForDegreeEdgeWeight) {
+  Graph graph(hypergraph, LouvainEdgeWeight::degree);
+  StarExpansionGraph star_expansion(hypergraph, LouvainEdgeWeight::degree);
+  verifyStarExpansion(graph, star_expansion);
+}
+
+TEST_F(AGraph, IteratesOverFirstNArcsOfImplicitStarExpansion) {
+  StarExpansionGraph star_expansion(hypergraph, LouvainEdgeWeight::uniform);
+  size_t num_arcs = 0;
+  for ( const Arc& arc : star_expansion.arcsOf(8, 2) ) {
+    ASSERT_LT(arc.head, 7);
+    ++num_arcs;
+  }
+  ASSERT_EQ(2, num_arcs);
+}
+
+TEST_F(AGraph, ContractsImplicitStarExpansion) {
+  Graph graph(hypergraph, LouvainEdgeWeight::uniform);
+  StarExpansionGraph star_expansion(hypergraph, LouvainEdgeWeight::uniform);
+  Clustering communities = clustering( { 0, 0, 1, 2, 2, 3, 3, 0, 1, 2, 3 } );
+  Clustering star_expansion_communities = communities;
+  Graph coarse_graph = graph.contract(communities, true);
+  Graph coarse_star_expansion = star_expansion.contract(star_expansion_communities);
+
+  ASSERT_EQ(communities, star_expansion_communities);
+  ASSERT_EQ(coarse_graph.numNodes(), coarse_star_expansion.numNodes());
+  ASSERT_EQ(coarse_graph.numArcs(), coarse_star_expansion.numArcs());
+  ASSERT_EQ(coarse_graph.totalVolume(), coarse_star_expansion.totalVolume());
+  for ( const NodeID& u : coarse_graph.nodes() ) {
+    ASSERT_EQ(coarse_graph.nodeVolume(u), coarse_star_expansion.nodeVolume(u));
+    std::vector<NodeID> arcs;
+    std::vector<ArcWeight> weights;
+    for ( const Arc& arc : coarse_graph.arcsOf(u) ) {
+      arcs.push_back(arc.head);
+      weights.push_back(arc.weight);
+    }
+    verifyArcIterator(coarse_star_expansion, u, arcs, weights);
+  }
+}
+
 } // namespace mt_kahypar::ds
\ No newline at end of file
@@ -209,6 +209,24 @@ TYPED_TEST(APartitionedHypergraph, PerformsConcurrentMovesWhereAllSucceed) {
 
 
 
+TYPED_TEST(APartitionedHypergraph, TracksPinCountsIfPartitionIsExclusivelyModifiedByOneThread) {
+  using PartitionedHyperGraph = typename TypeParam::PartitionedHyperGraph;
+  PartitionedHyperGraph local_phg(3, this->hypergraph, thread_exclusive_tag_t());
+  for ( const HypernodeID& hn : this->hypergraph.nodes() ) {
+    local_phg.setNodePart(hn, this->partitioned_hypergraph.partID(hn));
+  }
+  ASSERT_TRUE(local_phg.changeNodePart(0, 0, 1));
+  ASSERT_TRUE(local_phg.changeNodePart(6, 2, 0));
+
+  ASSERT_EQ(3, local_phg.partWeight(0));
+  ASSERT_EQ(3, local_phg.partWeight(1));
+  ASSERT_EQ(1, local_phg.partWeight(2));
+  ASSERT_TRUE(local_phg.checkTrackedPartitionInformation());
+  // Shared partition is not affected
+  this->verifyPartitionPinCounts(0, { 2, 0, 0 });
+  this->verifyPartitionPinCounts(2, { 0, 2, 1 });
+}
+
 TYPED_TEST(APartitionedHypergraph, HasCorrectInitialPartitionPinCounts) {
   this->verifyPartitionPinCounts(0, { 2, 0, 0 });
   this->verifyPartitionPinCounts(1, { 2, 2, 0 });
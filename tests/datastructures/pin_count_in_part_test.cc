@@ -713,5 +713,110 @@ TEST(APinCountInPart, ModifyTwoHyperedgesConcurrently3_k30_Max30) {
   ASSERT_EQ(30, pin_count.pinCountInPart(7, 19));
 }
 
+TEST(APinCountInPart, SetsPinCountOfBothBlocks_k2_Max1000000) {
+  const HyperedgeID num_hyperedges = 100;
+  const PartitionID k = 2;
+  const HypernodeID max_value = 1000000;
+  PinCountInPart pin_count(num_hyperedges, k, max_value);
+
+  pin_count.setPinCountInPart(4, 0, 999999);
+  pin_count.setPinCountInPart(4, 1, 1000000);
+  pin_count.setPinCountInPart(5, 1, 42);
+  ASSERT_EQ(999999, pin_count.pinCountInPart(4, 0));
+  ASSERT_EQ(1000000, pin_count.pinCountInPart(4, 1));
+  ASSERT_EQ(0, pin_count.pinCountInPart(5, 0));
+  ASSERT_EQ(42, pin_count.pinCountInPart(5, 1));
+}
+
+TEST(APinCountInPart, MovesPinsBetweenBothBlocks_k2_Max1000000) {
+  const HyperedgeID num_hyperedges = 100;
+  const PartitionID k = 2;
+  const HypernodeID max_value = 1000000;
+  PinCountInPart pin_count(num_hyperedges, k, max_value);
+
+  pin_count.setPinCountInPart(7, 0, 10);
+  for ( int i = 0; i < 10; ++i ) {
+    pin_count.decrementPinCountInPart(7, 0);
+    pin_count.incrementPinCountInPart(7, 1);
+  }
+  ASSERT_EQ(0, pin_count.pinCountInPart(7, 0));
+  ASSERT_EQ(10, pin_count.pinCountInPart(7, 1));
+  ASSERT_EQ(0, pin_count.pinCountInPart(6, 1));
+  ASSERT_EQ(0, pin_count.pinCountInPart(8, 0));
+}
+
+TEST(APinCountInPart, MovesPinAtomicallyWithinOneValue_k4_Max10) {
+  const HyperedgeID num_hyperedges = 100;
+  const PartitionID k = 4;
+  const HypernodeID max_value = 10;
+  PinCountInPart pin_count(num_hyperedges, k, max_value);
+
+  pin_count.setPinCountInPart(3, 1, 10);
+  pin_count.setPinCountInPart(3, 2, 0);
+  HypernodeID pin_count_in_from_part_after = 0;
+  HypernodeID pin_count_in_to_part_after = 0;
+  pin_count.movePinAtomically(3, 1, 2, pin_count_in_from_part_after, pin_count_in_to_part_after);
+  ASSERT_EQ(9, pin_count_in_from_part_after);
+  ASSERT_EQ(1, pin_count_in_to_part_after);
+  pin_count.movePinAtomically(3, 2, 0, pin_count_in_from_part_after, pin_count_in_to_part_after);
+  ASSERT_EQ(0, pin_count_in_from_part_after);
+  ASSERT_EQ(1, pin_count_in_to_part_after);
+  ASSERT_EQ(1, pin_count.pinCountInPart(3, 0));
+  ASSERT_EQ(9, pin_count.pinCountInPart(3, 1));
+  ASSERT_EQ(0, pin_count.pinCountInPart(3, 2));
+  ASSERT_EQ(0, pin_count.pinCountInPart(3, 3));
+  ASSERT_EQ(0, pin_count.pinCountInPart(2, 3));
+  ASSERT_EQ(0, pin_count.pinCountInPart(4, 0));
+}
+
+TEST(APinCountInPart, MovesPinAtomicallyBetweenDifferentValues_k32_Max30) {
+  const HyperedgeID num_hyperedges = 100;
+  const PartitionID k = 32;
+  const HypernodeID max_value = 30;
+  PinCountInPart pin_count(num_hyperedges, k, max_value);
+
+  pin_count.setPinCountInPart(5, 0, 30);
+  HypernodeID pin_count_in_from_part_after = 0;
+  HypernodeID pin_count_in_to_part_after = 0;
+  pin_count.movePinAtomically(5, 0, 31, pin_count_in_from_part_after, pin_count_in_to_part_after);
+  ASSERT_EQ(29, pin_count_in_from_part_after);
+  ASSERT_EQ(1, pin_count_in_to_part_after);
+  ASSERT_EQ(29, pin_count.pinCountInPart(5, 0));
+  ASSERT_EQ(1, pin_count.pinCountInPart(5, 31));
+  ASSERT_EQ(0, pin_count.pinCountInPart(5, 1));
+  ASSERT_EQ(0, pin_count.pinCountInPart(5, 30));
+}
+
+TEST(APinCountInPart, MovesPinsOfTheSameHyperedgeConcurrently_k8_Max1000) {
+  const HyperedgeID num_hyperedges = 10;
+  const PartitionID k = 8;
+  const HypernodeID max_value = 1000;
+  PinCountInPart pin_count(num_hyperedges, k, max_value);
+
+  // Both threads move 500 pins from block 0 to block 1 resp. 7 and count
+  // how often they observe that block 0 becomes empty
+  pin_count.setPinCountInPart(2, 0, 1000);
+  std::atomic<int> num_empty(0);
+  auto move_pins = [&](const PartitionID to) {
+    for ( int i = 0; i < 500; ++i ) {
+      HypernodeID pin_count_in_from_part_after = 0;
+      HypernodeID pin_count_in_to_part_after = 0;
+      pin_count.movePinAtomically(2, 0, to, pin_count_in_from_part_after, pin_count_in_to_part_after);
+      ASSERT_EQ(i + 1, pin_count_in_to_part_after);
+      if ( pin_count_in_from_part_after == 0 ) {
+        ++num_empty;
+      }
+    }
+  };
+  executeConcurrent([&] { move_pins(1); }, [&] { move_pins(7); });
+
+  ASSERT_EQ(1, num_empty.load());
+  ASSERT_EQ(0, pin_count.pinCountInPart(2, 0));
+  ASSERT_EQ(500, pin_count.pinCountInPart(2, 1));
+  ASSERT_EQ(500, pin_count.pinCountInPart(2, 7));
+  ASSERT_EQ(0, pin_count.pinCountInPart(1, 7));
+  ASSERT_EQ(0, pin_count.pinCountInPart(3, 0));
+}
+
 }  // namespace ds
 }  // namespace mt_kahypar
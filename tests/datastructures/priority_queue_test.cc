@@ -32,6 +32,7 @@
 
 #include "mt-kahypar/macros.h"
 #include "mt-kahypar/datastructures/priority_queue.h"
+#include "mt-kahypar/datastructures/bucket_priority_queue.h"
 
 
 
@@ -270,5 +271,108 @@ namespace BinaryHeap {
 
 }
 
+namespace BucketQueue {
+  using BucketPQ = BucketPriorityQueue<int, int>;
+
+  TEST(ABucketPriorityQueue, ReturnsMax) {
+    vec<PosT> positions(400, invalid_position);
+    BucketPQ h(positions.data(), positions.size(), 10);
+    h.insert(3, 4);
+    h.insert(2, 5);
+    h.insert(1, -7);
+    ASSERT_EQ(h.top(), 2);
+    ASSERT_EQ(h.topKey(), 5);
+    h.deleteTop();
+    ASSERT_EQ(h.top(), 3);
+    ASSERT_EQ(h.topKey(), 4);
+    h.deleteTop();
+    ASSERT_EQ(h.top(), 1);
+    ASSERT_EQ(h.topKey(), -7);
+  }
+
+  TEST(ABucketPriorityQueue, StoresKeysOutsideOfBucketRangeInOverflowHeap) {
+    vec<PosT> positions(400, invalid_position);
+    BucketPQ h(positions.data(), positions.size(), 10);
+    h.insert(3, 4);
+    h.insert(2, 500);
+    h.insert(1, std::numeric_limits<int>::min());
+    h.insert(0, 11);
+    ASSERT_EQ(h.top(), 2);
+    h.adjustKey(2, 3);
+    ASSERT_EQ(h.top(), 0);
+    ASSERT_EQ(h.topKey(), 11);
+    h.remove(0);
+    ASSERT_EQ(h.top(), 3);
+    h.deleteTop();
+    h.deleteTop();
+    ASSERT_EQ(h.top(), 1);
+    ASSERT_EQ(h.topKey(), std::numeric_limits<int>::min());
+    h.deleteTop();
+    ASSERT_TRUE(h.empty());
+  }
+
+  TEST(ABucketPriorityQueue, SharesPositionsWithOtherQueues) {
+    vec<PosT> positions(400, invalid_position);
+    BucketPQ h1(positions.data(), positions.size(), 10);
+    BucketPQ h2(positions.data(), positions.size(), 10);
+    h1.insert(3, 4);
+    h1.insert(2, 5);
+    h2.insert(1, 1);
+    h2.insert(0, 2);
+    ASSERT_TRUE(h1.contains(3));
+    ASSERT_FALSE(h1.contains(1));
+    ASSERT_TRUE(h2.contains(1));
+    ASSERT_FALSE(h2.contains(3));
+    h1.clear();
+    ASSERT_FALSE(h1.contains(3));
+    ASSERT_TRUE(h2.contains(0));
+    ASSERT_EQ(h2.top(), 0);
+  }
+
+  TEST(ABucketPriorityQueue, BehavesLikeAHeapForRandomOperations) {
+    const int n = 2000;
+    vec<PosT> bucket_positions(n, invalid_position);
+    BucketPQ bucket_pq(bucket_positions.data(), bucket_positions.size(), 50);
+    ExclusiveHandleHeap<MaxHeap<int, int>> heap(n);
+    std::mt19937 rng(420);
+    std::uniform_int_distribution<int> id_dist(0, n - 1);
+    std::uniform_int_distribution<int> key_dist(-70, 70);
+    std::uniform_int_distribution<int> op_dist(0, 3);
+    for (int i = 0; i < 100000; ++i) {
+      const int id = id_dist(rng);
+      const int key = key_dist(rng);
+      switch (op_dist(rng)) {
+        case 0:
+        case 1:
+          bucket_pq.insertOrAdjustKey(id, key);
+          heap.insertOrAdjustKey(id, key);
+          break;
+        case 2:
+          if (heap.contains(id)) {
+            bucket_pq.remove(id);
+            heap.remove(id);
+          }
+          break;
+        default:
+          if (!heap.empty()) {
+            ASSERT_EQ(heap.topKey(), bucket_pq.topKey());
+            const int top = bucket_pq.top();
+            ASSERT_EQ(heap.keyOf(top), bucket_pq.keyOf(top));
+            bucket_pq.deleteTop();
+            heap.remove(top);
+          }
+      }
+      ASSERT_EQ(heap.size(), bucket_pq.size());
+      ASSERT_EQ(heap.contains(id), bucket_pq.contains(id));
+    }
+    while (!heap.empty()) {
+      ASSERT_EQ(heap.topKey(), bucket_pq.topKey());
+      heap.remove(bucket_pq.top());
+      bucket_pq.deleteTop();
+    }
+    ASSERT_TRUE(bucket_pq.empty());
+  }
+}
+
 }  // namespace ds
 }  // namespace mt_kahypar
@@ -24,6 +24,8 @@
  * SOFTWARE.
  ******************************************************************************/
 
+#include <random>
+
 #include "gmock/gmock.h"
 
 #include "tests/datastructures/hypergraph_fixtures.h"
@@ -174,6 +176,53 @@ TEST_F(AStaticHypergraph, ModifiesEdgeWeight) {
   ASSERT_EQ(2, hypergraph.edgeWeight(2));
 }
 
+TEST_F(AStaticHypergraph, HasUnitWeightsIfUnweighted) {
+  ASSERT_TRUE(hypergraph.hasUnitHypernodeWeights());
+  ASSERT_TRUE(hypergraph.hasUnitHyperedgeWeights());
+}
+
+TEST_F(AStaticHypergraph, HasNoUnitWeightsIfWeightsAreModified) {
+  hypergraph.setNodeWeight(0, 1);
+  hypergraph.setEdgeWeight(0, 1);
+  ASSERT_TRUE(hypergraph.hasUnitHypernodeWeights());
+  ASSERT_TRUE(hypergraph.hasUnitHyperedgeWeights());
+  hypergraph.setNodeWeight(0, 2);
+  hypergraph.setEdgeWeight(0, 2);
+  ASSERT_FALSE(hypergraph.hasUnitHypernodeWeights());
+  ASSERT_FALSE(hypergraph.hasUnitHyperedgeWeights());
+}
+
+TEST_F(AStaticHypergraph, HasNoUnitWeightsIfWeightsAreModifiedConcurrently) {
+  tbb::parallel_for(ID(0), hypergraph.initialNumEdges(), [&](const HyperedgeID he) {
+    hypergraph.setEdgeWeight(he, he + 1);
+  });
+  ASSERT_FALSE(hypergraph.hasUnitHyperedgeWeights());
+  for ( const HyperedgeID& he : hypergraph.edges() ) {
+    ASSERT_EQ(he + 1, hypergraph.edgeWeight(he));
+  }
+}
+
+TEST_F(AStaticHypergraph, HasUnitWeightsIfAllInputWeightsAreOne) {
+  const std::vector<HyperedgeWeight> hyperedge_weights = { 1, 1, 1, 1 };
+  const std::vector<HypernodeWeight> hypernode_weights = { 1, 1, 1, 1, 1, 1, 2 };
+  StaticHypergraph weighted_hypergraph = StaticHypergraphFactory::construct(
+    7 , 4, { {0, 2}, {0, 1, 3, 4}, {3, 4, 6}, {2, 5, 6} },
+    hyperedge_weights.data(), hypernode_weights.data());
+  ASSERT_FALSE(weighted_hypergraph.hasUnitHypernodeWeights());
+  ASSERT_TRUE(weighted_hypergraph.hasUnitHyperedgeWeights());
+  ASSERT_EQ(2, weighted_hypergraph.nodeWeight(6));
+  ASSERT_EQ(8, weighted_hypergraph.totalWeight());
+}
+
+TEST_F(AStaticHypergraph, HasNoUnitWeightsAfterContraction) {
+  parallel::scalable_vector<HypernodeID> c_mapping = {1, 4, 1, 5, 5, 4, 5};
+  StaticHypergraph c_hypergraph = hypergraph.contract(c_mapping);
+  ASSERT_FALSE(c_hypergraph.hasUnitHypernodeWeights());
+  ASSERT_FALSE(c_hypergraph.hasUnitHyperedgeWeights());
+  ASSERT_EQ(2, c_hypergraph.nodeWeight(0));
+  ASSERT_EQ(3, c_hypergraph.nodeWeight(2));
+}
+
 TEST_F(AStaticHypergraph, VerifiesEdgeSizes) {
   ASSERT_EQ(2, hypergraph.edgeSize(0));
   ASSERT_EQ(4, hypergraph.edgeSize(1));
@@ -520,6 +569,97 @@ TEST_F(AStaticHypergraph, ContractCommunitiesIfCommunityInformationAreAvailable)
 
 }
 
+TEST_F(AStaticHypergraph, ContractsCommunitiesWithDisabledHypernodesUsingCountingSort) {
+  hypergraph.disableHypernode(0);
+  hypergraph.disableHypernode(6);
+  hypergraph.computeAndSetTotalNodeWeight(parallel_tag_t());
+
+  parallel::scalable_vector<HypernodeID> c_mapping = {0, 1, 1, 2, 2, 2, 6};
+  StaticHypergraph c_hypergraph = hypergraph.contract(c_mapping, true);
+
+  ASSERT_EQ(2, c_hypergraph.initialNumNodes());
+  ASSERT_EQ(1, c_hypergraph.initialNumEdges());
+  ASSERT_EQ(2, c_hypergraph.initialNumPins());
+  ASSERT_EQ(2, c_hypergraph.nodeWeight(0));
+  ASSERT_EQ(3, c_hypergraph.nodeWeight(1));
+  ASSERT_EQ(2, c_hypergraph.edgeWeight(0));
+  verifyIncidentNets(c_hypergraph, 0, { 0 });
+  verifyIncidentNets(c_hypergraph, 1, { 0 });
+  verifyPins(c_hypergraph, { 0 }, { {0, 1} });
+}
+
+TEST_F(AStaticHypergraph, ContractsCommunitiesWithDisabledHyperedgesUsingCountingSort) {
+  hypergraph.disableHyperedge(3);
+
+  parallel::scalable_vector<HypernodeID> c_mapping = {0, 0, 0, 1, 1, 2, 3};
+  StaticHypergraph c_hypergraph = hypergraph.contract(c_mapping, true);
+
+  ASSERT_EQ(4, c_hypergraph.initialNumNodes());
+  ASSERT_EQ(2, c_hypergraph.initialNumEdges());
+  ASSERT_EQ(4, c_hypergraph.initialNumPins());
+  verifyIncidentNets(c_hypergraph, 0, { 0 });
+  verifyIncidentNets(c_hypergraph, 1, { 0, 1 });
+  verifyIncidentNets(c_hypergraph, 2, { });
+  verifyIncidentNets(c_hypergraph, 3, { 1 });
+  verifyPins(c_hypergraph, { 0, 1 },
+    { {0, 1}, {1, 3} });
+}
+
+TEST_F(AStaticHypergraph, ContractsSameHypergraphWithCountingSort) {
+  const HypernodeID num_nodes = 1000;
+  const HyperedgeID num_edges = 2000;
+  std::mt19937 rng(42);
+  std::uniform_int_distribution<HypernodeID> node_dist(0, num_nodes - 1);
+  std::uniform_int_distribution<HypernodeID> size_dist(2, 10);
+  parallel::scalable_vector<parallel::scalable_vector<HypernodeID>> edges(num_edges);
+  for ( auto& edge : edges ) {
+    const HypernodeID size = size_dist(rng);
+    while ( edge.size() < size ) {
+      const HypernodeID pin = node_dist(rng);
+      if ( std::find(edge.begin(), edge.end(), pin) == edge.end() ) {
+        edge.push_back(pin);
+      }
+    }
+  }
+  StaticHypergraph expected_hypergraph = StaticHypergraphFactory::construct(num_nodes, num_edges, edges);
+  StaticHypergraph actual_hypergraph = StaticHypergraphFactory::construct(num_nodes, num_edges, edges);
+
+  // Contract two levels to check that the reused buffers are handled correctly
+  for ( const HypernodeID num_clusters : { 400, 100 } ) {
+    std::uniform_int_distribution<HypernodeID> cluster_dist(0, num_clusters - 1);
+    parallel::scalable_vector<HypernodeID> expected_mapping(expected_hypergraph.initialNumNodes());
+    for ( HypernodeID& cluster : expected_mapping ) {
+      cluster = cluster_dist(rng);
+    }
+    parallel::scalable_vector<HypernodeID> actual_mapping = expected_mapping;
+    StaticHypergraph expected = expected_hypergraph.contract(expected_mapping);
+    StaticHypergraph actual = actual_hypergraph.contract(actual_mapping, true);
+
+    ASSERT_EQ(expected_mapping, actual_mapping);
+    ASSERT_EQ(expected.initialNumNodes(), actual.initialNumNodes());
+    ASSERT_EQ(expected.initialNumEdges(), actual.initialNumEdges());
+    ASSERT_EQ(expected.initialNumPins(), actual.initialNumPins());
+    ASSERT_EQ(expected.initialTotalVertexDegree(), actual.initialTotalVertexDegree());
+    ASSERT_EQ(expected.maxEdgeSize(), actual.maxEdgeSize());
+    for ( const HypernodeID& hn : expected.nodes() ) {
+      ASSERT_EQ(expected.nodeWeight(hn), actual.nodeWeight(hn));
+      auto expected_nets = expected.incidentEdges(hn);
+      auto actual_nets = actual.incidentEdges(hn);
+      ASSERT_TRUE(std::equal(expected_nets.begin(), expected_nets.end(),
+                             actual_nets.begin(), actual_nets.end())) << V(hn);
+    }
+    for ( const HyperedgeID& he : expected.edges() ) {
+      ASSERT_EQ(expected.edgeWeight(he), actual.edgeWeight(he));
+      auto expected_pins = expected.pins(he);
+      auto actual_pins = actual.pins(he);
+      ASSERT_TRUE(std::equal(expected_pins.begin(), expected_pins.end(),
+                             actual_pins.begin(), actual_pins.end())) << V(he);
+    }
+    expected_hypergraph = std::move(expected);
+    actual_hypergraph = std::move(actual);
+  }
+}
+
 
 }
 } // namespace mt_kahypar
\ No newline at end of file
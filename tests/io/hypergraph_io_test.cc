@@ -24,6 +24,10 @@
  * SOFTWARE.
  ******************************************************************************/
 
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+
 #include "gmock/gmock.h"
 
 #include "tests/datastructures/hypergraph_fixtures.h"
@@ -87,7 +91,73 @@ class AHypergraphReader : public Test {
   Hypergraph hypergraph;
 };
 
+// ! Writes the content to a temporary file that is removed on destruction
+class TemporaryFile {
+ public:
+  explicit TemporaryFile(const std::string& content) :
+    filename("tmp_malformed_input_" + std::to_string(counter++)) {
+    std::ofstream out(filename);
+    out << content;
+  }
+
+  ~TemporaryFile() {
+    std::remove(filename.c_str());
+  }
+
+  const std::string filename;
+
+ private:
+  static int counter;
+};
+
+int TemporaryFile::counter = 0;
+
+TEST_F(AHypergraphReader, ThrowsOnMissingFile) {
+  ASSERT_THROW(readGraphFile("../tests/instances/does_not_exist.graph", true),
+               std::invalid_argument);
+}
+
+TEST_F(AHypergraphReader, ThrowsOnInvalidMetisFormat) {
+  TemporaryFile file("2 1 2\n2\n1\n");
+  ASSERT_THROW(readGraphFile(file.filename, true), std::invalid_argument);
+}
+
+TEST_F(AHypergraphReader, ThrowsOnMetisNeighborOutOfRange) {
+  TemporaryFile file("2 1\n2\n3\n");
+  ASSERT_THROW(readGraphFile(file.filename, true), std::invalid_argument);
+}
+
+TEST_F(AHypergraphReader, ThrowsOnMetisFileWithFewerVertices) {
+  TemporaryFile file("3 1\n2\n1\n");
+  ASSERT_THROW(readGraphFile(file.filename, true), std::invalid_argument);
+}
+
+TEST_F(AHypergraphReader, ThrowsOnMetisEdgeCountMismatch) {
+  TemporaryFile file("3 1\n2 3\n1 3\n1 2\n");
+  ASSERT_THROW(readGraphFile(file.filename, true), std::invalid_argument);
+}
+
 #ifndef USE_GRAPH_PARTITIONER
+TEST_F(AHypergraphReader, ThrowsOnInvalidHypergraphFormat) {
+  TemporaryFile file("1 2 2\n1 2\n");
+  ASSERT_THROW(this->readHypergraph(file.filename), std::invalid_argument);
+}
+
+TEST_F(AHypergraphReader, ThrowsOnPinOutOfRange) {
+  TemporaryFile file("2 4\n1 2\n1 5\n");
+  ASSERT_THROW(this->readHypergraph(file.filename), std::invalid_argument);
+}
+
+TEST_F(AHypergraphReader, ThrowsOnHypergraphFileWithFewerHyperedges) {
+  TemporaryFile file("3 4\n1 2\n");
+  ASSERT_THROW(this->readHypergraph(file.filename), std::invalid_argument);
+}
+
+TEST_F(AHypergraphReader, ThrowsOnMissingHypernodeWeights) {
+  TemporaryFile file("1 3 10\n1 2 3\n1\n2\n");
+  ASSERT_THROW(this->readHypergraph(file.filename), std::invalid_argument);
+}
+
 TEST_F(AHypergraphReader, ReadsAnUnweightedHypergraph) {
   this->readHypergraph("../tests/instances/unweighted_hypergraph.hgr");
 
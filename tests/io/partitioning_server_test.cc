@@ -0,0 +1,191 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2019 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include "gmock/gmock.h"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+#include "mt-kahypar/application/partitioning_server.h"
+
+using ::testing::Test;
+using ::testing::StartsWith;
+
+namespace mt_kahypar {
+
+class APartitioningServer : public Test {
+
+ public:
+  APartitioningServer() :
+    server(TBBInitializer::instance().total_number_of_threads()) { }
+
+  // ! Sends all requests to the server and returns one response per request
+  std::vector<std::string> serve(const std::vector<std::string>& requests) {
+    std::stringstream in;
+    for ( const std::string& request : requests ) {
+      in << request << "\n";
+    }
+    std::stringstream out;
+    server.run(in, out);
+    std::vector<std::string> responses;
+    std::string line;
+    while ( std::getline(out, line) ) {
+      responses.push_back(line);
+    }
+    return responses;
+  }
+
+  std::string partitionRequest(const std::string& options) const {
+    return "partition ibm01 -p ../config/default_preset.ini " + options;
+  }
+
+  PartitioningServer server;
+};
+
+const std::string load_request = "load ibm01 ../tests/instances/contracted_ibm01.hgr";
+
+TEST_F(APartitioningServer, LoadsAndListsHypergraphs) {
+  const auto responses = serve({ load_request, "list", "unload ibm01", "list", "quit" });
+  ASSERT_EQ(5, responses.size());
+  ASSERT_THAT(responses[0], StartsWith("ok loaded ibm01 nodes=640"));
+  ASSERT_EQ("ok ibm01", responses[1]);
+  ASSERT_EQ("ok unloaded ibm01", responses[2]);
+  ASSERT_EQ("ok", responses[3]);
+  ASSERT_EQ("ok bye", responses[4]);
+}
+
+TEST_F(APartitioningServer, AnswersInvalidRequestsWithAnError) {
+  const auto responses = serve({ "foo", "load ibm01", "load ibm01 /nonexistent.hgr",
+    "load ibm01 ../tests/instances/contracted_ibm01.hgr patoh", "partition unknown -k 2",
+    "unload unknown", "list" });
+  ASSERT_EQ(7, responses.size());
+  for ( size_t i = 0; i < 6; ++i ) {
+    ASSERT_THAT(responses[i], StartsWith("error")) << responses[i];
+  }
+  ASSERT_EQ("ok", responses[6]);
+}
+
+TEST_F(APartitioningServer, AnswersMalformedInputFilesWithAnError) {
+  const std::string filename = "tmp_server_malformed_input.hgr";
+  std::ofstream(filename) << "2 4\n1 2\n1 5\n";
+  const auto responses = serve({ "load broken " + filename,
+    "load broken ../tests/instances/unweighted_hypergraph.hgr metis",
+    "load dir ../tests/instances", load_request, "list" });
+  std::remove(filename.c_str());
+  ASSERT_EQ(5, responses.size());
+  for ( size_t i = 0; i < 3; ++i ) {
+    ASSERT_THAT(responses[i], StartsWith("error")) << responses[i];
+  }
+  ASSERT_THAT(responses[3], StartsWith("ok loaded ibm01"));
+  ASSERT_EQ("ok ibm01", responses[4]);
+}
+
+TEST_F(APartitioningServer, DoesNotWriteLibraryOutputToStdout) {
+  const std::string filename = "tmp_server_duplicated_pins.hgr";
+  std::ofstream(filename) << "2 3\n1 2 2\n2 3\n";
+  std::stringstream captured;
+  std::streambuf* stdout_buffer = std::cout.rdbuf(captured.rdbuf());
+  const auto responses = serve({ "load dup " + filename, load_request,
+    partitionRequest("-k 2 -e 0.03 -o km1 -m direct") });
+  std::cout.rdbuf(stdout_buffer);
+  std::remove(filename.c_str());
+  ASSERT_EQ(3, responses.size());
+  ASSERT_THAT(responses[0], StartsWith("ok loaded dup nodes=3 edges=2 pins=4"));
+  ASSERT_THAT(responses[2], StartsWith("ok partitioned ibm01 k=2"));
+  ASSERT_EQ("", captured.str());
+}
+
+TEST_F(APartitioningServer, RejectsInvalidOptionValues) {
+  std::string no_ip_algos = "--i-enabled-ip-algos";
+  for ( size_t i = 0; i < static_cast<size_t>(InitialPartitioningAlgorithm::UNDEFINED); ++i ) {
+    no_ip_algos += " 0";
+  }
+  const auto responses = serve({ load_request,
+    partitionRequest("-k 2 -e 0.03 -o km1 -m direct --c-type foo"),
+    partitionRequest("-k 2 -e 0.03 -o km1 -m direct --r-lp-type foo"),
+    partitionRequest("-k 2 -e 0.03 -o km1 -m direct --i-enabled-ip-algos 1 1"),
+    partitionRequest("-k 2 -e 0.03 -o km1 -m direct " + no_ip_algos),
+    partitionRequest("-k 2 -e 0.03 -o km1 -m direct") });
+  ASSERT_EQ(6, responses.size());
+  for ( size_t i = 1; i < 5; ++i ) {
+    ASSERT_THAT(responses[i], StartsWith("error")) << responses[i];
+  }
+  ASSERT_THAT(responses[5], StartsWith("ok partitioned ibm01 k=2"));
+}
+
+TEST_F(APartitioningServer, RejectsInvalidPartitionRequests) {
+  const auto responses = serve({ load_request,
+    partitionRequest("--help"),
+    "partition ibm01 -p /nonexistent.ini -k 2 -e 0.03 -o km1 -m direct",
+    partitionRequest("-k 2 -e 0.03 -o km1 -m foo"),
+    partitionRequest("-k 2 -e 0.03 -o foo -m direct"),
+    partitionRequest("-k 2 -e 0.03 -m direct"),
+    partitionRequest("-k 2 -e 0.03 -o km1 -m direct -t " +
+      std::to_string(TBBInitializer::instance().total_number_of_threads() + 1)),
+    partitionRequest("-k 1 -e 0.03 -o km1 -m direct"),
+    partitionRequest("-k 2 -e 0.03 -o km1 -m direct") });
+  ASSERT_EQ(9, responses.size());
+  ASSERT_THAT(responses[0], StartsWith("ok loaded"));
+  for ( size_t i = 1; i < 8; ++i ) {
+    ASSERT_THAT(responses[i], StartsWith("error")) << responses[i];
+  }
+  ASSERT_THAT(responses[8], StartsWith("ok partitioned ibm01 k=2"));
+}
+
+TEST_F(APartitioningServer, RejectsDeepMultilevelPartitioningInDeterministicMode) {
+  const auto responses = serve({ load_request,
+    "partition ibm01 -p ../config/deterministic_preset.ini -k 2 -e 0.03 -o km1 -m deep",
+    "partition ibm01 -p ../config/deterministic_preset.ini -k 2 -e 0.03 -o km1 -m direct --i-mode deep",
+    "partition ibm01 -p ../config/deterministic_preset.ini -k 2 -e 0.03 -o km1 -m direct" });
+  ASSERT_EQ(4, responses.size());
+  ASSERT_THAT(responses[1], StartsWith("error")) << responses[1];
+  ASSERT_THAT(responses[2], StartsWith("error")) << responses[2];
+  ASSERT_THAT(responses[3], StartsWith("ok partitioned ibm01 k=2"));
+}
+
+TEST_F(APartitioningServer, PartitionsWithCutObjectiveAndFMPreset) {
+  // The preset uses FM refinement which only supports the km1 metric. The server
+  // must not ask on stdin whether FM should be disabled.
+  const auto responses = serve({ load_request,
+    partitionRequest("-k 4 -e 0.03 -o cut -m direct"),
+    partitionRequest("-k 4 -e 0.03 -o km1 -m direct"),
+    "list" });
+  ASSERT_EQ(4, responses.size());
+  ASSERT_THAT(responses[1], StartsWith("ok partitioned ibm01 k=4"));
+  ASSERT_THAT(responses[2], StartsWith("ok partitioned ibm01 k=4"));
+  ASSERT_EQ("ok ibm01", responses[3]);
+}
+
+TEST_F(APartitioningServer, AcceptsTheNumberOfThreadsOfTheServer) {
+  const auto responses = serve({ load_request,
+    partitionRequest("-k 2 -e 0.03 -o km1 -m direct -t " +
+      std::to_string(TBBInitializer::instance().total_number_of_threads())) });
+  ASSERT_EQ(2, responses.size());
+  ASSERT_THAT(responses[1], StartsWith("ok partitioned ibm01 k=2"));
+}
+
+}  // namespace mt_kahypar
@@ -24,6 +24,9 @@
  * SOFTWARE.
  ******************************************************************************/
 
+#include <numeric>
+#include <set>
+
 #include "gmock/gmock.h"
 
 #include "tests/partition/coarsening/coarsener_fixtures.h"
@@ -97,4 +100,234 @@ TEST_F(ACoarsener, ProjectsPartitionBackToOriginalHypergraph) {
   }
 }
 
+#ifndef USE_STRONG_PARTITIONER
+TEST_F(ACoarsener, ReusesHierarchyForLargerContractionLimit) {
+  context.coarsening.contraction_limit = 2;
+  UncoarseningData uncoarseningData(nlevel, hypergraph, context);
+  Coarsener coarsener(hypergraph, context, uncoarseningData);
+  doCoarsening(coarsener);
+  ASSERT_GE(uncoarseningData.hierarchy.size(), 1UL);
+
+  Context reuse_context(context);
+  reuse_context.partition.k = 3;
+  reuse_context.setupPartWeights(hypergraph.totalWeight());
+  reuse_context.coarsening.contraction_limit = hypergraph.initialNumNodes();
+  uncoarseningData.reuseHierarchy(reuse_context);
+  ASSERT_EQ(1UL, uncoarseningData.hierarchy.size());
+  PartitionedHyperGraph& coarsest_partitioned_hypergraph =
+    uncoarseningData.coarsestPartitionedHypergraph();
+  ASSERT_EQ(3, coarsest_partitioned_hypergraph.k());
+  ASSERT_EQ(uncoarseningData.hierarchy[0].contractedHypergraph().initialNumNodes(),
+            coarsest_partitioned_hypergraph.initialNumNodes());
+}
+
+TEST_F(ACoarsener, ClustersUnmatchedLeavesOfAStarWithTwoHopClustering) {
+  // Only one leaf can be matched with the center due to the maximum allowed node weight
+  Hypergraph star = HypergraphFactory::construct(9, 8,
+    { { 0, 1 }, { 0, 2 }, { 0, 3 }, { 0, 4 }, { 0, 5 }, { 0, 6 }, { 0, 7 }, { 0, 8 } });
+  context.coarsening.contraction_limit = 1;
+  context.coarsening.max_allowed_node_weight = 2;
+  context.coarsening.minimum_shrink_factor = 1.2;
+
+  Hypergraph expected_star = star.copy();
+  UncoarseningData expected_uncoarseningData(nlevel, expected_star, context);
+  Coarsener expected_coarsener(expected_star, context, expected_uncoarseningData);
+  doCoarsening(expected_coarsener);
+  ASSERT_EQ(9, currentNumNodes(expected_coarsener.coarsestHypergraph()));
+
+  context.coarsening.use_two_hop_clustering = true;
+  context.coarsening.two_hop_shrink_factor_threshold = 2.0;
+  UncoarseningData uncoarseningData(nlevel, star, context);
+  Coarsener coarsener(star, context, uncoarseningData);
+  doCoarsening(coarsener);
+  // The seven unmatched leaves form three pairs
+  Hypergraph& coarsest = coarsener.coarsestHypergraph();
+  ASSERT_EQ(5, currentNumNodes(coarsest));
+  for ( const HypernodeID& hn : coarsest.nodes() ) {
+    ASSERT_LE(coarsest.nodeWeight(hn), 2);
+  }
+}
+
+TEST_F(ACoarsener, ClustersOnlyVerticesOfTheSameCommunityWithTwoHopClustering) {
+  // The center can only be matched with a leaf of its own community. The
+  // remaining leaves of both communities have the center as favorite neighbor.
+  Hypergraph star = HypergraphFactory::construct(9, 8,
+    { { 0, 1 }, { 0, 2 }, { 0, 3 }, { 0, 4 }, { 0, 5 }, { 0, 6 }, { 0, 7 }, { 0, 8 } });
+  for ( const HypernodeID& hn : star.nodes() ) {
+    star.setCommunityID(hn, hn <= 4 ? 0 : 1);
+  }
+  context.coarsening.contraction_limit = 1;
+  context.coarsening.max_allowed_node_weight = 2;
+  context.coarsening.minimum_shrink_factor = 1.2;
+  context.coarsening.use_two_hop_clustering = true;
+  context.coarsening.two_hop_shrink_factor_threshold = 2.0;
+
+  UncoarseningData uncoarseningData(nlevel, star, context);
+  Coarsener coarsener(star, context, uncoarseningData);
+  doCoarsening(coarsener);
+  // Contracted vertices inherit the community of their representative
+  Hypergraph& coarsest = coarsener.coarsestHypergraph();
+  for ( const HypernodeID& hn : star.nodes() ) {
+    HypernodeID coarse_hn = hn;
+    for ( size_t i = 0; i < uncoarseningData.hierarchy.size(); ++i ) {
+      coarse_hn = uncoarseningData.hierarchy[i].mapToContractedHypergraph(coarse_hn);
+    }
+    ASSERT_EQ(star.communityID(hn), coarsest.communityID(coarse_hn)) << V(hn);
+  }
+}
+
+TEST_F(ACoarsener, ComputesSameHierarchyInRepeatedRunsWithLargeNetSampling) {
+  // All hyperedges with more than two pins are sampled
+  context.coarsening.contraction_limit = 4;
+  context.coarsening.large_net_sampling_threshold = 2;
+  context.coarsening.large_net_sample_size = 2;
+
+  Hypergraph sampled_hypergraph = hypergraph.copy();
+  UncoarseningData uncoarseningData(nlevel, hypergraph, context);
+  Coarsener coarsener(hypergraph, context, uncoarseningData);
+  doCoarsening(coarsener);
+  ASSERT_LT(currentNumNodes(coarsener.coarsestHypergraph()), hypergraph.initialNumNodes());
+
+  UncoarseningData sampled_uncoarseningData(nlevel, sampled_hypergraph, context);
+  Coarsener sampled_coarsener(sampled_hypergraph, context, sampled_uncoarseningData);
+  doCoarsening(sampled_coarsener);
+  ASSERT_EQ(uncoarseningData.hierarchy.size(), sampled_uncoarseningData.hierarchy.size());
+  for ( size_t i = 0; i < uncoarseningData.hierarchy.size(); ++i ) {
+    const HypernodeID num_fine_nodes = i == 0 ? hypergraph.initialNumNodes() :
+      uncoarseningData.hierarchy[i - 1].contractedHypergraph().initialNumNodes();
+    for ( HypernodeID hn = 0; hn < num_fine_nodes; ++hn ) {
+      ASSERT_EQ(uncoarseningData.hierarchy[i].mapToContractedHypergraph(hn),
+                sampled_uncoarseningData.hierarchy[i].mapToContractedHypergraph(hn));
+    }
+  }
+}
+
+TEST_F(ACoarsener, ReachesContractionLimitOfUnsampledCoarseningWithLargeNetSampling) {
+  context.coarsening.contraction_limit = 4;
+  Hypergraph sampled_hypergraph = hypergraph.copy();
+  UncoarseningData reference_uncoarseningData(nlevel, hypergraph, context);
+  Coarsener reference_coarsener(hypergraph, context, reference_uncoarseningData);
+  doCoarsening(reference_coarsener);
+
+  // All hyperedges with more than two pins are sampled
+  Context sampled_context(context);
+  sampled_context.coarsening.large_net_sampling_threshold = 2;
+  sampled_context.coarsening.large_net_sample_size = 2;
+  UncoarseningData sampled_uncoarseningData(nlevel, sampled_hypergraph, sampled_context);
+  Coarsener sampled_coarsener(sampled_hypergraph, sampled_context, sampled_uncoarseningData);
+  doCoarsening(sampled_coarsener);
+
+  const Hypergraph& reference = reference_coarsener.coarsestHypergraph();
+  const Hypergraph& sampled = sampled_coarsener.coarsestHypergraph();
+  ASSERT_LE(currentNumNodes(reference), context.coarsening.contraction_limit);
+  ASSERT_LE(currentNumNodes(sampled), context.coarsening.contraction_limit);
+  ASSERT_EQ(hypergraph.totalWeight(), sampled.totalWeight());
+  // Contracted vertices do not cross community boundaries
+  for ( const HypernodeID& hn : sampled_hypergraph.nodes() ) {
+    HypernodeID coarse_hn = hn;
+    for ( size_t i = 0; i < sampled_uncoarseningData.hierarchy.size(); ++i ) {
+      coarse_hn = sampled_uncoarseningData.hierarchy[i].mapToContractedHypergraph(coarse_hn);
+    }
+    ASSERT_EQ(sampled_hypergraph.communityID(hn), sampled.communityID(coarse_hn)) << V(hn);
+  }
+}
+
+class ALargeNetSampler : public Test {
+ public:
+  using Rater = MultilevelVertexPairRater<HeavyEdgeScore, NoWeightPenalty, BestRatingWithoutTieBreaking>;
+
+  ALargeNetSampler() :
+    hypergraph(),
+    context(),
+    cluster_ids() {
+    // Hyperedge 0 contains all vertices, the remaining hyperedges form a path
+    parallel::scalable_vector<parallel::scalable_vector<HypernodeID>> edge_vector(1);
+    for ( HypernodeID hn = 0; hn < num_nodes; ++hn ) {
+      edge_vector[0].push_back(hn);
+      if ( hn + 1 < num_nodes ) {
+        edge_vector.push_back({ hn, hn + 1 });
+      }
+    }
+    hypergraph = HypergraphFactory::construct(num_nodes, edge_vector.size(), edge_vector);
+    context.coarsening.large_net_sampling_threshold = sample_size;
+    context.coarsening.large_net_sample_size = sample_size;
+    context.coarsening.use_adaptive_edge_size = false;
+    cluster_ids.resize(num_nodes);
+    std::iota(cluster_ids.begin(), cluster_ids.end(), ID(0));
+  }
+
+  static constexpr HypernodeID num_nodes = 200;
+  static constexpr size_t sample_size = 10;
+
+  Hypergraph hypergraph;
+  Context context;
+  parallel::scalable_vector<HypernodeID> cluster_ids;
+};
+
+TEST_F(ALargeNetSampler, SamplesDistinctPinsOfALargeHyperedge) {
+  Rater rater(hypergraph, context);
+  const parallel::scalable_vector<HypernodeID> representatives =
+    rater.sampleRepresentatives(hypergraph, 0, cluster_ids);
+  ASSERT_GE(representatives.size(), 1);
+  ASSERT_LE(representatives.size(), sample_size);
+  std::set<HypernodeID> distinct_representatives;
+  for ( const HypernodeID& representative : representatives ) {
+    ASSERT_LT(representative, num_nodes);
+    ASSERT_TRUE(distinct_representatives.insert(representative).second) << V(representative);
+  }
+}
+
+TEST_F(ALargeNetSampler, SamplesOnlyClusterIDsOfPins) {
+  for ( HypernodeID hn = 0; hn < num_nodes; ++hn ) {
+    cluster_ids[hn] = 4 * (hn / 4);
+  }
+  Rater rater(hypergraph, context);
+  const parallel::scalable_vector<HypernodeID> representatives =
+    rater.sampleRepresentatives(hypergraph, 0, cluster_ids);
+  ASSERT_GE(representatives.size(), 1);
+  ASSERT_LE(representatives.size(), sample_size);
+  for ( const HypernodeID& representative : representatives ) {
+    ASSERT_EQ(0, representative % 4) << V(representative);
+  }
+}
+
+TEST_F(ALargeNetSampler, SamplesTheSamePinsForAllPinsOfAHyperedge) {
+  Rater rater(hypergraph, context);
+  const parallel::scalable_vector<HypernodeID> expected =
+    rater.sampleRepresentatives(hypergraph, 0, cluster_ids);
+  // Each pin rates the hyperedge on its own thread-local data structures
+  tbb::enumerable_thread_specific<size_t> num_differences(0);
+  tbb::parallel_for(ID(0), num_nodes, [&](const HypernodeID) {
+    if ( rater.sampleRepresentatives(hypergraph, 0, cluster_ids) != expected ) {
+      ++num_differences.local();
+    }
+  });
+  ASSERT_EQ(0, num_differences.combine(std::plus<size_t>()));
+
+  // The sample changes with the seed
+  context.partition.seed = 21;
+  Rater other_rater(hypergraph, context);
+  ASSERT_NE(expected, other_rater.sampleRepresentatives(hypergraph, 0, cluster_ids));
+}
+
+TEST_F(ALargeNetSampler, ComputesEdgeSizeOfSampledHyperedges) {
+  Rater rater(hypergraph, context);
+  ASSERT_EQ(num_nodes, rater.sampledEdgeSize(num_nodes, 1));
+  ASSERT_EQ(num_nodes, rater.sampledEdgeSize(num_nodes, sample_size));
+}
+
+TEST_F(ALargeNetSampler, ExtrapolatesAdaptiveEdgeSizeOfSampledHyperedges) {
+  context.coarsening.use_adaptive_edge_size = true;
+  Rater rater(hypergraph, context);
+  ASSERT_EQ(num_nodes, rater.sampledEdgeSize(num_nodes, sample_size));
+  ASSERT_EQ(num_nodes / 2, rater.sampledEdgeSize(num_nodes, sample_size / 2));
+  // The extrapolated edge size is at least two
+  ASSERT_EQ(2, rater.sampledEdgeSize(num_nodes, 0));
+  for ( size_t num_representatives = 0; num_representatives <= sample_size; ++num_representatives ) {
+    ASSERT_GE(rater.sampledEdgeSize(num_nodes, num_representatives), 2);
+    ASSERT_LE(rater.sampledEdgeSize(num_nodes, num_representatives), num_nodes);
+  }
+}
+#endif
+
 }  // namespace mt_kahypar
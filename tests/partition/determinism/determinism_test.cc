@@ -26,6 +26,8 @@
 
 #include "gmock/gmock.h"
 
+#include <tbb/task_arena.h>
+
 #include "mt-kahypar/partition/context.h"
 #include "mt-kahypar/io/hypergraph_io.h"
 
@@ -33,7 +35,10 @@
 
 #include "mt-kahypar/partition/coarsening/deterministic_multilevel_coarsener.h"
 #include "mt-kahypar/partition/refinement/deterministic/deterministic_label_propagation.h"
+#include "mt-kahypar/partition/refinement/deterministic/deterministic_multitry_fm.h"
 #include "mt-kahypar/partition/preprocessing/community_detection/parallel_louvain.h"
+#include "mt-kahypar/partition/partitioner.h"
+#include "mt-kahypar/utils/randomize.h"
 
 using ::testing::Test;
 
@@ -80,6 +85,13 @@ namespace mt_kahypar {
       context.refinement.label_propagation.maximum_iterations = 5;
       context.refinement.deterministic_refinement.use_active_node_set = false;
       context.refinement.deterministic_refinement.recalculate_gains_on_second_apply = false;
+      context.refinement.deterministic_refinement.num_sub_rounds_fm = 4;
+      context.refinement.fm.algorithm = FMAlgorithm::deterministic;
+      context.refinement.fm.multitry_rounds = 10;
+      context.refinement.fm.num_seed_nodes = 25;
+      context.refinement.fm.rollback_parallel = true;
+      context.refinement.fm.rollback_balance_violation_factor = 1.0;
+      context.refinement.fm.min_improvement = -1.0;
 
       context.partition.objective = Objective::km1;
 
@@ -103,6 +115,7 @@ namespace mt_kahypar {
       metrics.imbalance = metrics::imbalance(partitioned_hypergraph, context);
     }
 
+    template<typename Refiner = DeterministicLabelPropagationRefiner>
     void performRepeatedRefinement() {
       initialPartition();
       vec<PartitionID> initial_partition(hypergraph.initialNumNodes());
@@ -117,7 +130,7 @@ namespace mt_kahypar {
           partitioned_hypergraph.setNodePart(u, initial_partition[u]);
         }
 
-        DeterministicLabelPropagationRefiner refiner(hypergraph, context);
+        Refiner refiner(hypergraph, context);
         refiner.initialize(partitioned_hypergraph);
         vec<HypernodeID> dummy_refinement_nodes;
         Metrics my_metrics = metrics;
@@ -235,4 +248,81 @@ namespace mt_kahypar {
     performRepeatedRefinement();
   }
 
+  TEST_F(DeterminismTest, FMRefinement) {
+    performRepeatedRefinement<DeterministicMultiTryFM>();
+  }
+
+  TEST_F(DeterminismTest, FMRefinementK2) {
+    context.partition.k = 2;
+    partitioned_hypergraph = PartitionedHypergraph(
+            context.partition.k, hypergraph, parallel_tag_t());
+    context.setupPartWeights(hypergraph.totalWeight());
+    performRepeatedRefinement<DeterministicMultiTryFM>();
+  }
+
+  TEST_F(DeterminismTest, FMRefinementOnCoarseHypergraph) {
+    UncoarseningData uncoarseningData(false, hypergraph, context);
+    DeterministicMultilevelCoarsener coarsener(hypergraph, context, uncoarseningData);
+    coarsener.coarsen();
+    hypergraph = coarsener.coarsestHypergraph().copy();
+    partitioned_hypergraph = PartitionedHypergraph(
+            context.partition.k, hypergraph, parallel_tag_t());
+    performRepeatedRefinement<DeterministicMultiTryFM>();
+  }
+
+  vec<PartitionID> partitionWithDeterministicPreset(const std::string& filename,
+                                                    const size_t num_threads) {
+    Context context;
+    context.load_deterministic_preset();
+    context.partition.graph_filename = filename;
+    context.partition.mode = Mode::direct;
+    context.partition.objective = Objective::km1;
+    context.partition.k = 8;
+    context.partition.epsilon = 0.03;
+    context.partition.seed = 42;
+    context.partition.verbose_output = false;
+    context.shared_memory.num_threads = num_threads;
+    utils::Randomize::instance().setSeed(context.partition.seed);
+
+    tbb::task_arena arena(num_threads);
+    return arena.execute([&] {
+      Hypergraph hypergraph = io::readHypergraphFile(filename, true);
+      PartitionedHypergraph partitioned_hypergraph = partition(hypergraph, context);
+      vec<PartitionID> blocks(hypergraph.initialNumNodes());
+      for ( const HypernodeID& hn : hypergraph.nodes() ) {
+        blocks[hn] = partitioned_hypergraph.partID(hn);
+      }
+      return blocks;
+    });
+  }
+
+  // ! The task arena cannot use more threads than the task scheduler initialized
+  // ! by TBBInitializer in run_tests.cpp (hardware concurrency). Thus, only the
+  // ! numbers of threads that the machine can run in parallel are tested.
+  std::vector<size_t> supportedNumbersOfThreads(const std::vector<size_t>& num_threads) {
+    std::vector<size_t> supported;
+    for ( const size_t t : num_threads ) {
+      if ( t <= std::thread::hardware_concurrency() ) {
+        supported.push_back(t);
+      }
+    }
+    return supported;
+  }
+
+  TEST(DeterminismAcrossThreads, ProducesSamePartitionForDifferentNumbersOfThreads) {
+    const std::vector<size_t> numbers_of_threads = supportedNumbersOfThreads({ 4, 16, 64 });
+    if ( numbers_of_threads.empty() ) {
+      GTEST_SKIP() << "Requires at least 4 hardware threads";
+    }
+    const std::string filename = "../tests/instances/powersim.mtx.hgr";
+    const vec<PartitionID> expected = partitionWithDeterministicPreset(filename, 1);
+    for ( const size_t num_threads : numbers_of_threads ) {
+      const vec<PartitionID> actual = partitionWithDeterministicPreset(filename, num_threads);
+      ASSERT_EQ(expected.size(), actual.size());
+      for ( size_t hn = 0; hn < expected.size(); ++hn ) {
+        ASSERT_EQ(expected[hn], actual[hn]) << V(hn) << V(num_threads);
+      }
+    }
+  }
+
 }  // namespace mt_kahypar
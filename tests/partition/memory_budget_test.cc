@@ -0,0 +1,90 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2019 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include "gmock/gmock.h"
+
+#include "mt-kahypar/definitions.h"
+#include "mt-kahypar/io/command_line_options.h"
+#include "mt-kahypar/io/hypergraph_io.h"
+#include "mt-kahypar/partition/context.h"
+#include "mt-kahypar/partition/memory_budget.h"
+
+using ::testing::Test;
+
+namespace mt_kahypar {
+
+class AMemoryBudget : public Test {
+
+ public:
+  AMemoryBudget() :
+    hypergraph(io::readHypergraphFile("../tests/instances/contracted_ibm01.hgr")),
+    context() {
+    parseIniToContext(context, "../config/default_preset.ini");
+    context.partition.mode = Mode::direct;
+    context.partition.objective = Objective::km1;
+    context.partition.epsilon = 0.03;
+    context.partition.k = 8;
+    context.partition.verbose_output = false;
+    context.shared_memory.num_threads = 4;
+  }
+
+  Hypergraph hypergraph;
+  Context context;
+};
+
+TEST_F(AMemoryBudget, IncludesTheReducedCopyOfTheInputHypergraph) {
+  const size_t peak = memory_budget::estimatePeakMemory(hypergraph, context);
+  context.preprocessing.contract_twin_vertices = true;
+  ASSERT_GT(memory_budget::estimatePeakMemory(hypergraph, context), peak);
+}
+
+TEST_F(AMemoryBudget, IncludesTheReorderedCopyOfTheInputHypergraph) {
+  const size_t peak = memory_budget::estimatePeakMemory(hypergraph, context);
+  context.preprocessing.node_ordering = NodeOrdering::bfs;
+  ASSERT_GT(memory_budget::estimatePeakMemory(hypergraph, context), peak);
+}
+
+TEST_F(AMemoryBudget, KeepsAlgorithmsIfBudgetIsLargeEnough) {
+  const Context original_context = context;
+  context.shared_memory.memory_budget = 1000000;
+  ASSERT_TRUE(memory_budget::enforceMemoryBudget(hypergraph, context));
+  ASSERT_EQ(original_context.refinement.fm.algorithm, context.refinement.fm.algorithm);
+  ASSERT_EQ(original_context.preprocessing.use_community_detection,
+            context.preprocessing.use_community_detection);
+  ASSERT_EQ(original_context.initial_partitioning.population_size,
+            context.initial_partitioning.population_size);
+}
+
+TEST_F(AMemoryBudget, SelectsLowerMemoryAlgorithmsIfBudgetIsExceeded) {
+  context.preprocessing.node_ordering = NodeOrdering::bfs;
+  context.shared_memory.memory_budget = 1;
+  ASSERT_FALSE(memory_budget::enforceMemoryBudget(hypergraph, context));
+  ASSERT_EQ(FMAlgorithm::fm_recompute_gain, context.refinement.fm.algorithm);
+  ASSERT_FALSE(context.preprocessing.use_community_detection);
+  ASSERT_EQ(1, context.initial_partitioning.population_size);
+}
+
+}  // namespace mt_kahypar
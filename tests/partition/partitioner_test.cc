@@ -0,0 +1,138 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2019 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include "gmock/gmock.h"
+
+#include "mt-kahypar/definitions.h"
+#include "mt-kahypar/io/command_line_options.h"
+#include "mt-kahypar/io/hypergraph_io.h"
+#include "mt-kahypar/partition/context.h"
+#include "mt-kahypar/partition/metrics.h"
+#include "mt-kahypar/partition/partitioner.h"
+
+using ::testing::Test;
+
+namespace mt_kahypar {
+
+class APartitioner : public Test {
+
+ public:
+  Context createContext(const PartitionID k) const {
+    Context context;
+    parseIniToContext(context, "../config/default_preset.ini");
+    context.partition.graph_filename = "../tests/instances/ibm01.hgr";
+    context.partition.mode = Mode::direct;
+    context.partition.objective = Objective::km1;
+    context.partition.epsilon = 0.03;
+    context.partition.k = k;
+    context.partition.seed = 42;
+    context.partition.verbose_output = false;
+    context.shared_memory.num_threads = std::thread::hardware_concurrency();
+    return context;
+  }
+
+  void verifyPartition(Hypergraph& hypergraph,
+                       const Context& context,
+                       const vec<PartitionID>& partition) const {
+    PartitionedHypergraph partitioned_hypergraph(context.partition.k, hypergraph, parallel_tag_t());
+    for ( const HypernodeID& hn : hypergraph.nodes() ) {
+      ASSERT_GE(partition[hn], 0);
+      ASSERT_LT(partition[hn], context.partition.k);
+      partitioned_hypergraph.setOnlyNodePart(hn, partition[hn]);
+    }
+    partitioned_hypergraph.initializePartition();
+    for ( PartitionID block = 0; block < context.partition.k; ++block ) {
+      ASSERT_LE(partitioned_hypergraph.partWeight(block), context.partition.max_part_weights[block])
+        << V(context.partition.k) << V(block);
+    }
+    ASSERT_LE(metrics::imbalance(partitioned_hypergraph, context), context.partition.epsilon)
+      << V(context.partition.k);
+  }
+};
+
+TEST_F(APartitioner, ComputesBalancedPartitionsForMultipleK) {
+  Hypergraph hypergraph = io::readHypergraphFile("../tests/instances/ibm01.hgr");
+  vec<Context> contexts;
+  for ( const PartitionID k : { 2, 8, 32, 4 } ) {
+    contexts.push_back(createContext(k));
+  }
+
+  const vec<vec<PartitionID>> partitions = partitionForMultipleK(hypergraph, contexts);
+  ASSERT_EQ(contexts.size(), partitions.size());
+  for ( size_t i = 0; i < contexts.size(); ++i ) {
+    ASSERT_EQ(hypergraph.initialNumNodes(), partitions[i].size());
+    verifyPartition(hypergraph, contexts[i], partitions[i]);
+  }
+}
+
+TEST_F(APartitioner, ProjectsPartitionAndCommunitiesOfReducedHypergraphOntoInput) {
+  // Builds a copy of ibm01 in which each net is duplicated and the first
+  // vertices have a twin vertex with exactly the same incident nets
+  Hypergraph original_hypergraph = io::readHypergraphFile("../tests/instances/ibm01.hgr");
+  const HypernodeID num_original_nodes = original_hypergraph.initialNumNodes();
+  const HypernodeID num_twins = 1000;
+  parallel::scalable_vector<parallel::scalable_vector<HypernodeID>> edge_vector;
+  for ( const HyperedgeID& he : original_hypergraph.edges() ) {
+    parallel::scalable_vector<HypernodeID> pins;
+    for ( const HypernodeID& pin : original_hypergraph.pins(he) ) {
+      pins.push_back(pin);
+      if ( pin < num_twins ) {
+        pins.push_back(num_original_nodes + pin);
+      }
+    }
+    edge_vector.push_back(pins);
+    edge_vector.push_back(pins);
+  }
+  Hypergraph hypergraph = HypergraphFactory::construct(
+    num_original_nodes + num_twins, edge_vector.size(), edge_vector);
+
+  Context context = createContext(8);
+  context.preprocessing.contract_twin_vertices = true;
+  context.preprocessing.merge_identical_nets = true;
+  PartitionedHypergraph partitioned_hypergraph = partition(hypergraph, context);
+
+  ASSERT_EQ(&hypergraph, &partitioned_hypergraph.hypergraph());
+  vec<PartitionID> partition(hypergraph.initialNumNodes());
+  for ( const HypernodeID& hn : hypergraph.nodes() ) {
+    partition[hn] = partitioned_hypergraph.partID(hn);
+  }
+  verifyPartition(hypergraph, context, partition);
+  for ( HypernodeID hn = 0; hn < num_twins; ++hn ) {
+    ASSERT_EQ(partition[hn], partition[num_original_nodes + hn]) << V(hn);
+    ASSERT_EQ(hypergraph.communityID(hn), hypergraph.communityID(num_original_nodes + hn)) << V(hn);
+  }
+
+  // The objective of the projected partition must match the partition of the input
+  PartitionedHypergraph reference(context.partition.k, hypergraph, parallel_tag_t());
+  for ( const HypernodeID& hn : hypergraph.nodes() ) {
+    reference.setOnlyNodePart(hn, partition[hn]);
+  }
+  reference.initializePartition();
+  ASSERT_EQ(metrics::km1(reference), metrics::km1(partitioned_hypergraph));
+  ASSERT_EQ(metrics::hyperedgeCut(reference), metrics::hyperedgeCut(partitioned_hypergraph));
+}
+
+}  // namespace mt_kahypar
@@ -0,0 +1,159 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2021 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+
+#include "gmock/gmock.h"
+
+#include <cstdio>
+
+#include "tests/datastructures/hypergraph_fixtures.h"
+#include "mt-kahypar/io/hypergraph_io.h"
+#include "mt-kahypar/partition/context.h"
+#include "mt-kahypar/partition/partitioner.h"
+#include "mt-kahypar/partition/preprocessing/community_detection/community_cache.h"
+
+using ::testing::Test;
+
+namespace mt_kahypar::community_detection {
+
+class ACommunityCache : public ds::HypergraphFixture<Hypergraph, HypergraphFactory> {
+
+ using Base = ds::HypergraphFixture<Hypergraph, HypergraphFactory>;
+
+ public:
+  ACommunityCache() :
+    Base(),
+    context(),
+    filename("community_cache_test.community") {
+    context.preprocessing.community_detection.edge_weight_function = LouvainEdgeWeight::uniform;
+    context.preprocessing.community_detection.max_pass_iterations = 100;
+    context.preprocessing.community_detection.min_vertex_move_fraction = 0.0001;
+    context.preprocessing.community_detection.vertex_degree_sampling_threshold = 200000;
+    std::remove(filename.c_str());
+  }
+
+  ~ACommunityCache() {
+    std::remove(filename.c_str());
+  }
+
+  using Base::hypergraph;
+  Context context;
+  std::string filename;
+};
+
+ds::Clustering communities() {
+  ds::Clustering c = { 0, 0, 1, 2, 2, 1, 2 };
+  return c;
+}
+
+TEST_F(ACommunityCache, ReadsWrittenCommunities) {
+  const CommunityCacheKey key = computeCommunityCacheKey(hypergraph, context);
+  writeCommunityCache(filename, key, communities());
+
+  ds::Clustering read_communities;
+  ASSERT_TRUE(readCommunityCache(filename, key, read_communities));
+  ASSERT_EQ(communities(), read_communities);
+}
+
+TEST_F(ACommunityCache, DoesNotReadNonExistingFile) {
+  const CommunityCacheKey key = computeCommunityCacheKey(hypergraph, context);
+  ds::Clustering read_communities;
+  ASSERT_FALSE(readCommunityCache(filename, key, read_communities));
+}
+
+TEST_F(ACommunityCache, DoesNotReadCommunitiesOfDifferentInput) {
+  writeCommunityCache(filename, computeCommunityCacheKey(hypergraph, context), communities());
+
+  Hypergraph other_hypergraph = HypergraphFactory::construct(
+    7 , 4, { {0, 2}, {0, 1, 3, 4}, {3, 4, 6}, {2, 5} }, nullptr, nullptr, true);
+  ds::Clustering read_communities;
+  ASSERT_FALSE(readCommunityCache(filename,
+    computeCommunityCacheKey(other_hypergraph, context), read_communities));
+}
+
+TEST_F(ACommunityCache, DoesNotReadCommunitiesComputedWithDifferentSettings) {
+  writeCommunityCache(filename, computeCommunityCacheKey(hypergraph, context), communities());
+
+  context.preprocessing.community_detection.edge_weight_function = LouvainEdgeWeight::degree;
+  ds::Clustering read_communities;
+  ASSERT_FALSE(readCommunityCache(filename,
+    computeCommunityCacheKey(hypergraph, context), read_communities));
+}
+
+TEST_F(ACommunityCache, DoesNotReadCommunitiesComputedWithDifferentSeed) {
+  for ( const bool deterministic : { false, true } ) {
+    context.partition.deterministic = deterministic;
+    context.partition.seed = 0;
+    writeCommunityCache(filename, computeCommunityCacheKey(hypergraph, context), communities());
+
+    context.partition.seed = 1;
+    ds::Clustering read_communities;
+    ASSERT_FALSE(readCommunityCache(filename,
+      computeCommunityCacheKey(hypergraph, context), read_communities)) << V(deterministic);
+  }
+}
+
+TEST_F(ACommunityCache, HasSameKeyIfPinsAndHyperedgesArePermuted) {
+  Hypergraph permuted_hypergraph = HypergraphFactory::construct(
+    7 , 4, { {3, 4, 6}, {2, 0}, {6, 5, 2}, {4, 3, 1, 0} }, nullptr, nullptr, true);
+  const CommunityCacheKey key = computeCommunityCacheKey(hypergraph, context);
+  const CommunityCacheKey permuted_key = computeCommunityCacheKey(permuted_hypergraph, context);
+  ASSERT_EQ(key.input_checksum, permuted_key.input_checksum);
+  ASSERT_EQ(key.settings_checksum, permuted_key.settings_checksum);
+}
+
+TEST_F(ACommunityCache, IsUsedBySubsequentPreprocessingRuns) {
+  context.partition.verbose_output = false;
+  context.preprocessing.use_community_detection = true;
+  context.preprocessing.cache_communities = true;
+  context.partition.graph_community_cache_filename = filename;
+  context.shared_memory.num_threads = std::thread::hardware_concurrency();
+  const std::string graph_filename = "../tests/instances/contracted_unweighted_ibm01.hgr";
+
+  Hypergraph first_hypergraph = io::readHypergraphFile(graph_filename);
+  preprocess(first_hypergraph, context);
+  const CommunityCacheKey key = computeCommunityCacheKey(first_hypergraph, context);
+  ds::Clustering cached_communities;
+  ASSERT_TRUE(readCommunityCache(filename, key, cached_communities));
+  for ( const HypernodeID& hn : first_hypergraph.nodes() ) {
+    ASSERT_EQ(first_hypergraph.communityID(hn), cached_communities[hn]);
+  }
+
+  // Replace the cached communities with singletons, which Louvain does not
+  // compute on this instance. Thus, we can observe that the cache is used.
+  for ( const HypernodeID& hn : first_hypergraph.nodes() ) {
+    cached_communities[hn] = hn;
+  }
+  writeCommunityCache(filename, key, cached_communities);
+
+  Hypergraph second_hypergraph = io::readHypergraphFile(graph_filename);
+  preprocess(second_hypergraph, context);
+  for ( const HypernodeID& hn : second_hypergraph.nodes() ) {
+    ASSERT_EQ(static_cast<PartitionID>(hn), second_hypergraph.communityID(hn));
+  }
+}
+
+}  // namespace mt_kahypar::community_detection
@@ -0,0 +1,110 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2021 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include <numeric>
+
+#include "gmock/gmock.h"
+
+#include "mt-kahypar/definitions.h"
+#include "mt-kahypar/partition/preprocessing/reduction/hypergraph_reduction.h"
+
+using ::testing::Test;
+
+namespace mt_kahypar {
+namespace reduction {
+
+class AHypergraphReduction : public Test {
+ public:
+  AHypergraphReduction() :
+    hypergraph(HypergraphFactory::construct(8, 7,
+      { {0, 1, 2}, {0, 1, 2}, {1, 2, 3}, {3, 4}, {4, 5, 6}, {4, 5, 6}, {1, 2} },
+      edge_weights.data(), node_weights.data())) { }
+
+  void verifyNets(const Hypergraph& reduced,
+                  const std::vector<std::vector<HypernodeID>>& expected_pins,
+                  const std::vector<HyperedgeWeight>& expected_weights) {
+    ASSERT_EQ(expected_pins.size(), reduced.initialNumEdges());
+    for ( const HyperedgeID& he : reduced.edges() ) {
+      std::vector<HypernodeID> pins;
+      for ( const HypernodeID& pin : reduced.pins(he) ) {
+        pins.push_back(pin);
+      }
+      std::sort(pins.begin(), pins.end());
+      ASSERT_EQ(expected_pins[he], pins);
+      ASSERT_EQ(expected_weights[he], reduced.edgeWeight(he));
+    }
+  }
+
+  const std::vector<HyperedgeWeight> edge_weights = { 1, 2, 3, 4, 5, 6, 7 };
+  const std::vector<HypernodeWeight> node_weights = { 1, 2, 3, 4, 5, 6, 7, 8 };
+  Hypergraph hypergraph;
+};
+
+TEST_F(AHypergraphReduction, ComputesTwinRepresentatives) {
+  const vec<HypernodeID> representatives = computeTwinRepresentatives(hypergraph, 100);
+  ASSERT_EQ(vec<HypernodeID>({ 0, 1, 1, 3, 4, 5, 5, 7 }), representatives);
+}
+
+TEST_F(AHypergraphReduction, DoesNotContractTwinsIfTheyExceedMaximumNodeWeight) {
+  const vec<HypernodeID> representatives = computeTwinRepresentatives(hypergraph, 4);
+  ASSERT_EQ(vec<HypernodeID>({ 0, 1, 2, 3, 4, 5, 6, 7 }), representatives);
+}
+
+TEST_F(AHypergraphReduction, ContractsTwinsAndMergesIdenticalNets) {
+  const vec<HypernodeID> representatives = computeTwinRepresentatives(hypergraph, 100);
+  vec<HypernodeID> node_mapping;
+  Hypergraph reduced = reduceHypergraph(hypergraph, representatives, true, false, node_mapping);
+
+  ASSERT_EQ(vec<HypernodeID>({ 0, 1, 1, 2, 3, 4, 4, 5 }), node_mapping);
+  ASSERT_EQ(6, reduced.initialNumNodes());
+  ASSERT_EQ(hypergraph.totalWeight(), reduced.totalWeight());
+  const std::vector<HypernodeWeight> expected_node_weights = { 1, 5, 4, 5, 13, 8 };
+  for ( const HypernodeID& hn : reduced.nodes() ) {
+    ASSERT_EQ(expected_node_weights[hn], reduced.nodeWeight(hn));
+  }
+  // The single-pin net { 1, 2 } is removed and identical nets are merged
+  verifyNets(reduced, { {0, 1}, {1, 2}, {2, 3}, {3, 4} }, { 3, 3, 4, 11 });
+}
+
+TEST_F(AHypergraphReduction, ContractsTwinsWithoutMergingIdenticalNets) {
+  const vec<HypernodeID> representatives = computeTwinRepresentatives(hypergraph, 100);
+  vec<HypernodeID> node_mapping;
+  Hypergraph reduced = reduceHypergraph(hypergraph, representatives, false, false, node_mapping);
+  verifyNets(reduced, { {0, 1}, {0, 1}, {1, 2}, {2, 3}, {3, 4}, {3, 4} }, { 1, 2, 3, 4, 5, 6 });
+}
+
+TEST_F(AHypergraphReduction, MergesIdenticalNetsWithoutContractingTwins) {
+  vec<HypernodeID> representatives(hypergraph.initialNumNodes());
+  std::iota(representatives.begin(), representatives.end(), 0);
+  vec<HypernodeID> node_mapping;
+  Hypergraph reduced = reduceHypergraph(hypergraph, representatives, true, false, node_mapping);
+
+  ASSERT_EQ(representatives, node_mapping);
+  verifyNets(reduced, { {0, 1, 2}, {1, 2, 3}, {3, 4}, {4, 5, 6}, {1, 2} }, { 3, 3, 4, 11, 7 });
+}
+
+} // namespace reduction
+} // namespace mt_kahypar
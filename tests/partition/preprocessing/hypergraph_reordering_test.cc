@@ -0,0 +1,145 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2021 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include "gmock/gmock.h"
+
+#include "mt-kahypar/definitions.h"
+#include "mt-kahypar/partition/preprocessing/reordering/hypergraph_reordering.h"
+
+using ::testing::Test;
+
+namespace mt_kahypar {
+namespace reordering {
+
+class AHypergraphReordering : public Test {
+ public:
+  AHypergraphReordering() :
+    hypergraph(HypergraphFactory::construct(8, 5,
+      { {0, 5}, {0, 3, 6}, {1, 5}, {2, 6}, {3, 4} },
+      edge_weights.data(), node_weights.data())) {
+    hypergraph.setCommunityIDs({ 1, 0, 2, 1, 0, 2, 0, 1 });
+  }
+
+  void verifyPermutation(const vec<HypernodeID>& node_mapping) {
+    ASSERT_EQ(hypergraph.initialNumNodes(), node_mapping.size());
+    vec<bool> contained(node_mapping.size(), false);
+    for ( const HypernodeID& new_id : node_mapping ) {
+      ASSERT_LT(new_id, node_mapping.size());
+      ASSERT_FALSE(contained[new_id]);
+      contained[new_id] = true;
+    }
+  }
+
+  const std::vector<HyperedgeWeight> edge_weights = { 1, 2, 3, 4, 5 };
+  const std::vector<HypernodeWeight> node_weights = { 1, 2, 3, 4, 5, 6, 7, 8 };
+  Hypergraph hypergraph;
+};
+
+TEST_F(AHypergraphReordering, ComputesIdentityIfNoOrderingIsSelected) {
+  const vec<HypernodeID> node_mapping = computeNodeOrder(hypergraph, NodeOrdering::none);
+  ASSERT_EQ(vec<HypernodeID>({ 0, 1, 2, 3, 4, 5, 6, 7 }), node_mapping);
+}
+
+TEST_F(AHypergraphReordering, ComputesBFSOrder) {
+  const vec<HypernodeID> node_mapping = computeNodeOrder(hypergraph, NodeOrdering::bfs);
+  verifyPermutation(node_mapping);
+  // Level 1 = { 3, 5, 6 } (parent 0), level 2 = { 4 (parent 3), 1 (parent 5), 2 (parent 6) },
+  // vertex 7 is isolated and forms its own component
+  ASSERT_EQ(vec<HypernodeID>({ 0, 5, 6, 1, 4, 2, 3, 7 }), node_mapping);
+}
+
+TEST_F(AHypergraphReordering, ComputesCommunityOrder) {
+  const vec<HypernodeID> node_mapping = computeNodeOrder(hypergraph, NodeOrdering::communities);
+  verifyPermutation(node_mapping);
+  ASSERT_EQ(vec<HypernodeID>({ 3, 0, 6, 4, 1, 7, 2, 5 }), node_mapping);
+}
+
+TEST_F(AHypergraphReordering, ConstructsReorderedHypergraph) {
+  const vec<HypernodeID> node_mapping = computeNodeOrder(hypergraph, NodeOrdering::bfs);
+  vec<HyperedgeID> original_edge_ids;
+  Hypergraph reordered = reorderHypergraph(hypergraph, node_mapping, false, original_edge_ids);
+
+  ASSERT_EQ(hypergraph.initialNumNodes(), reordered.initialNumNodes());
+  ASSERT_EQ(hypergraph.initialNumEdges(), reordered.initialNumEdges());
+  ASSERT_EQ(hypergraph.initialNumPins(), reordered.initialNumPins());
+  ASSERT_EQ(hypergraph.totalWeight(), reordered.totalWeight());
+  for ( const HypernodeID& hn : hypergraph.nodes() ) {
+    ASSERT_EQ(hypergraph.nodeWeight(hn), reordered.nodeWeight(node_mapping[hn]));
+    ASSERT_EQ(hypergraph.communityID(hn), reordered.communityID(node_mapping[hn]));
+    ASSERT_EQ(hypergraph.nodeDegree(hn), reordered.nodeDegree(node_mapping[hn]));
+  }
+
+  // Nets are sorted by their smallest pin (ties are broken by the original net ID)
+  const std::vector<std::vector<HypernodeID>> expected_pins =
+    { {0, 2}, {0, 1, 3}, {1, 4}, {2, 5}, {3, 6} };
+  const std::vector<HyperedgeWeight> expected_weights = { 1, 2, 5, 3, 4 };
+  for ( const HyperedgeID& he : reordered.edges() ) {
+    std::vector<HypernodeID> pins;
+    for ( const HypernodeID& pin : reordered.pins(he) ) {
+      pins.push_back(pin);
+    }
+    std::sort(pins.begin(), pins.end());
+    ASSERT_EQ(expected_pins[he], pins);
+    ASSERT_EQ(expected_weights[he], reordered.edgeWeight(he));
+  }
+  ASSERT_EQ(vec<HyperedgeID>({ 0, 1, 4, 2, 3 }), original_edge_ids);
+}
+
+TEST_F(AHypergraphReordering, RestoresInputHypergraphFromReorderedHypergraph) {
+  // Single-pin nets removed while reading the input are part of the statistics
+  hypergraph.setNumRemovedHyperedges(2);
+  const vec<HypernodeID> node_mapping = computeNodeOrder(hypergraph, NodeOrdering::bfs);
+  vec<HyperedgeID> original_edge_ids;
+  Hypergraph reordered = reorderHypergraph(hypergraph, node_mapping, false, original_edge_ids);
+  Hypergraph restored = restoreHypergraph(reordered, node_mapping, original_edge_ids, false);
+
+  ASSERT_EQ(hypergraph.initialNumNodes(), restored.initialNumNodes());
+  ASSERT_EQ(2, restored.numRemovedHyperedges());
+  ASSERT_EQ(hypergraph.initialNumEdges(), restored.initialNumEdges());
+  ASSERT_EQ(hypergraph.initialNumPins(), restored.initialNumPins());
+  ASSERT_EQ(hypergraph.totalWeight(), restored.totalWeight());
+  for ( const HypernodeID& hn : hypergraph.nodes() ) {
+    ASSERT_EQ(hypergraph.nodeWeight(hn), restored.nodeWeight(hn));
+    ASSERT_EQ(hypergraph.communityID(hn), restored.communityID(hn));
+    ASSERT_EQ(hypergraph.nodeDegree(hn), restored.nodeDegree(hn));
+  }
+  // Nets keep their IDs and the order of their pins
+  for ( const HyperedgeID& he : hypergraph.edges() ) {
+    std::vector<HypernodeID> expected_pins;
+    for ( const HypernodeID& pin : hypergraph.pins(he) ) {
+      expected_pins.push_back(pin);
+    }
+    std::vector<HypernodeID> pins;
+    for ( const HypernodeID& pin : restored.pins(he) ) {
+      pins.push_back(pin);
+    }
+    ASSERT_EQ(expected_pins, pins);
+    ASSERT_EQ(hypergraph.edgeWeight(he), restored.edgeWeight(he));
+  }
+}
+
+} // namespace reordering
+} // namespace mt_kahypar
@@ -186,4 +186,21 @@ TEST_F(ALouvain, KarateClubTest) {
             metrics::modularity(*karate_club_graph, expected_comm));
 }
 
+TEST_F(ALouvain, ComputesSameCommunitiesOnImplicitStarExpansion) {
+  context.partition.deterministic = true;
+  context.preprocessing.community_detection.low_memory_contraction = true;
+  tbb::task_arena sequential_arena(1);
+  Graph star_expansion(karate_club_hg, LouvainEdgeWeight::uniform, false);
+  StarExpansionGraph implicit_star_expansion(karate_club_hg, LouvainEdgeWeight::uniform);
+  ds::Clustering communities = sequential_arena.execute([&] {
+    return run_parallel_louvain(star_expansion, context, true);
+  });
+  ds::Clustering implicit_communities = sequential_arena.execute([&] {
+    return run_parallel_louvain(implicit_star_expansion, context, true);
+  });
+  ASSERT_EQ(communities, implicit_communities);
+  ASSERT_EQ(metrics::modularity(implicit_star_expansion, implicit_communities),
+            metrics::modularity(Graph(karate_club_hg, LouvainEdgeWeight::uniform, false), communities));
+}
+
 }  // namespace mt_kahypar
@@ -157,4 +157,14 @@ TYPED_TEST(ALabelPropagationRefiner, DoesNotWorsenSolutionQuality) {
   this->refiner->refine(this->partitioned_hypergraph, {}, this->metrics, std::numeric_limits<double>::max());
   ASSERT_LE(this->metrics.getMetric(Mode::direct, this->context.partition.objective), objective_before);
 }
+
+TYPED_TEST(ALabelPropagationRefiner, UpdatesMetricsCorrectlyInCacheBlockedMode) {
+  this->context.refinement.label_propagation.cache_block_size = 64;
+  HyperedgeWeight objective_before = metrics::objective(this->partitioned_hypergraph, this->context.partition.objective);
+  this->refiner->refine(this->partitioned_hypergraph, {}, this->metrics, std::numeric_limits<double>::max());
+  ASSERT_EQ(metrics::objective(this->partitioned_hypergraph, this->context.partition.objective),
+            this->metrics.getMetric(Mode::direct, this->context.partition.objective));
+  ASSERT_LE(this->metrics.getMetric(Mode::direct, this->context.partition.objective), objective_before);
+  ASSERT_LE(this->metrics.imbalance, this->context.partition.epsilon + EPS);
+}
 }  // namespace mt_kahypar
@@ -149,6 +149,66 @@ TEST(RollbackTests, GainRecalculation2) {
   grb.verifyGains<true>(phg, sharedData);
 }
 
+TEST(RollbackTests, ParallelAndSequentialRollbackFindPrefixWithSameGain) {
+  const HypernodeID num_nodes = 10000;
+  const HyperedgeID num_nets = 10000;
+  const PartitionID k = 8;
+  std::mt19937 rng(420);
+  parallel::scalable_vector<parallel::scalable_vector<HypernodeID>> nets(num_nets);
+  for (auto& net : nets) {
+    const size_t size = 2 + rng() % 4;
+    while (net.size() < size) {
+      const HypernodeID pin = rng() % num_nodes;
+      if (std::find(net.begin(), net.end(), pin) == net.end()) {
+        net.push_back(pin);
+      }
+    }
+  }
+  Hypergraph hg = HypergraphFactory::construct(num_nodes, num_nets, nets);
+
+  // moves are long enough to be split into several ranges by the parallel rollback
+  vec<Move> moves;
+  for (HypernodeID u = 0; u < num_nodes; ++u) {
+    const PartitionID from = u % k;
+    moves.push_back(Move { from, static_cast<PartitionID>((from + 1 + rng() % (k - 1)) % k), u, 0 });
+  }
+  std::shuffle(moves.begin(), moves.end(), rng);
+
+  auto rollback = [&](const bool parallel) {
+    PartitionedHypergraph phg(k, hg);
+    for (HypernodeID u = 0; u < num_nodes; ++u) {
+      phg.setNodePart(u, u % k);
+    }
+
+    Context context;
+    context.partition.k = k;
+    context.partition.epsilon = 0.03;
+    context.setupPartWeights(phg.totalWeight());
+    context.refinement.fm.rollback_parallel = parallel;
+    context.refinement.fm.rollback_balance_violation_factor = 1.0;
+    context.shared_memory.num_threads = 4;
+
+    FMSharedData sharedData(hg.initialNumNodes(), context);
+    vec<HypernodeWeight> part_weights(k, 0);
+    for (PartitionID i = 0; i < k; ++i) {
+      part_weights[i] = phg.partWeight(i);
+    }
+    for (Move m : moves) {
+      phg.changeNodePart(m.node, m.from, m.to);
+      sharedData.moveTracker.insertMove(m);
+    }
+
+    GlobalRollback grb(hg, context);
+    const HyperedgeWeight gain = grb.revertToBestPrefix<false>(phg, sharedData, part_weights);
+    return std::make_pair(gain, metrics::km1(phg, false));
+  };
+
+  const auto parallel_result = rollback(true);
+  const auto sequential_result = rollback(false);
+  ASSERT_EQ(sequential_result.first, parallel_result.first);
+  ASSERT_EQ(sequential_result.second, parallel_result.second);
+}
+
 //#endif
 
 }   // namespace mt_kahypar
@@ -0,0 +1,176 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2021 Lars Gottesbüren <lars.gottesbueren@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "gmock/gmock.h"
+
+#include "mt-kahypar/partition/refinement/fm/strategies/target_block_selection.h"
+
+using ::testing::Test;
+
+namespace mt_kahypar {
+namespace target_block_selection {
+
+using SelectFunc = PartitionID (*)(const Gain*, const HypernodeWeight*, const HypernodeWeight*,
+                                   const PartitionID, const PartitionID, const HypernodeWeight);
+
+struct Selection {
+  std::string name;
+  SelectFunc select;
+};
+
+// ! All vectorized selections that are supported by the CPU (and the dispatching
+// ! select(...) function, which must agree with them)
+std::vector<Selection> vectorizedSelections() {
+  std::vector<Selection> selections = { Selection { "dispatch", select } };
+  #ifdef MT_KAHYPAR_HAS_X86_SIMD_DISPATCH
+  __builtin_cpu_init();
+  if ( __builtin_cpu_supports("avx2") ) {
+    selections.push_back(Selection { "avx2", impl::selectAVX2 });
+  }
+  if ( __builtin_cpu_supports("avx512f") ) {
+    selections.push_back(Selection { "avx512", impl::selectAVX512 });
+  }
+  #endif
+  return selections;
+}
+
+class ATargetBlockSelection : public Test {
+ public:
+  ATargetBlockSelection() :
+    selections(vectorizedSelections()),
+    // Entries of blocks >= k must never be read
+    benefits(kMaxVectorizedBlocks + 8, 1000),
+    weights(kMaxVectorizedBlocks + 8, 0),
+    max_weights(kMaxVectorizedBlocks + 8, 1000) { }
+
+  void verify(const PartitionID k, const PartitionID from,
+              const HypernodeWeight node_weight, const PartitionID expected) {
+    ASSERT_EQ(expected, selectScalar(benefits.data(), weights.data(),
+      max_weights.data(), k, from, node_weight)) << "scalar";
+    for ( const Selection& selection : selections ) {
+      ASSERT_EQ(expected, selection.select(benefits.data(), weights.data(),
+        max_weights.data(), k, from, node_weight)) << selection.name << " " << V(k);
+    }
+  }
+
+  std::vector<Selection> selections;
+  std::vector<Gain> benefits;
+  std::vector<HypernodeWeight> weights;
+  std::vector<HypernodeWeight> max_weights;
+};
+
+TEST_F(ATargetBlockSelection, SelectsBlockWithHighestBenefit) {
+  benefits = { 3, 5, 7, 2, 1000, 1000, 1000, 1000,
+               1000, 1000, 1000, 1000, 1000, 1000, 1000, 1000 };
+  verify(4, 0, 1, 2);
+}
+
+TEST_F(ATargetBlockSelection, NeverSelectsTheSourceBlock) {
+  benefits = { 3, 5, 7, 2, 1000, 1000, 1000, 1000,
+               1000, 1000, 1000, 1000, 1000, 1000, 1000, 1000 };
+  verify(4, 2, 1, 1);
+}
+
+TEST_F(ATargetBlockSelection, BreaksTiesInFavorOfTheLighterBlock) {
+  for ( PartitionID k = 3; k <= kMaxVectorizedBlocks; ++k ) {
+    std::fill(benefits.begin(), benefits.begin() + k, 4);
+    std::fill(weights.begin(), weights.begin() + k, 10);
+    weights[k - 1] = 9;
+    verify(k, 0, 1, k - 1);
+  }
+}
+
+TEST_F(ATargetBlockSelection, BreaksTiesInFavorOfTheSmallerBlockID) {
+  for ( PartitionID k = 3; k <= kMaxVectorizedBlocks; ++k ) {
+    std::fill(benefits.begin(), benefits.begin() + k, 4);
+    std::fill(weights.begin(), weights.begin() + k, 10);
+    weights[1] = 11;
+    verify(k, 0, 1, 2);
+  }
+}
+
+TEST_F(ATargetBlockSelection, RejectsBlocksThatWouldExceedTheirWeightLimit) {
+  for ( PartitionID k = 2; k <= kMaxVectorizedBlocks; ++k ) {
+    std::fill(benefits.begin(), benefits.begin() + k, 1);
+    std::fill(weights.begin(), weights.begin() + k, 10);
+    std::fill(max_weights.begin(), max_weights.begin() + k, 12);
+    // The block with the highest benefit would become overloaded
+    benefits[k - 1] = 5;
+    weights[k - 1] = 11;
+    verify(k, 0, 2, k == 2 ? kInvalidPartition : 1);
+  }
+}
+
+TEST_F(ATargetBlockSelection, ReturnsInvalidBlockIfNoBlockIsFeasible) {
+  for ( PartitionID k = 2; k <= kMaxVectorizedBlocks; ++k ) {
+    std::fill(weights.begin(), weights.begin() + k, 10);
+    std::fill(max_weights.begin(), max_weights.begin() + k, 10);
+    verify(k, 0, 1, kInvalidPartition);
+  }
+}
+
+TEST_F(ATargetBlockSelection, IgnoresEntriesBeyondTheNumberOfBlocks) {
+  // k is not a multiple of the vector width and the entries of blocks >= k
+  // have the highest benefit and are the lightest blocks
+  for ( const PartitionID k : { 3, 5, 7, 9, 13, 15 } ) {
+    std::fill(benefits.begin(), benefits.end(), 1000);
+    std::fill(weights.begin(), weights.end(), 0);
+    std::fill(benefits.begin(), benefits.begin() + k, 2);
+    std::fill(weights.begin(), weights.begin() + k, 5);
+    verify(k, 0, 1, 1);
+  }
+}
+
+TEST_F(ATargetBlockSelection, AgreesWithScalarSelectionOnRandomInstances) {
+  std::mt19937 rng(420);
+  // Small value ranges provoke many ties and infeasible blocks
+  std::uniform_int_distribution<Gain> benefit_dist(-4, 4);
+  std::uniform_int_distribution<HypernodeWeight> weight_dist(90, 110);
+  std::uniform_int_distribution<HypernodeWeight> node_weight_dist(1, 5);
+  for ( PartitionID k = 2; k <= kMaxVectorizedBlocks; ++k ) {
+    std::uniform_int_distribution<PartitionID> block_dist(0, k - 1);
+    for ( size_t i = 0; i < 1000; ++i ) {
+      for ( PartitionID block = 0; block < k; ++block ) {
+        benefits[block] = benefit_dist(rng);
+        weights[block] = weight_dist(rng);
+        max_weights[block] = weight_dist(rng) + 5;
+      }
+      const PartitionID from = block_dist(rng);
+      const HypernodeWeight node_weight = node_weight_dist(rng);
+      const PartitionID expected = selectScalar(benefits.data(),
+        weights.data(), max_weights.data(), k, from, node_weight);
+      verify(k, from, node_weight, expected);
+    }
+  }
+}
+
+}  // namespace target_block_selection
+}  // namespace mt_kahypar
@@ -0,0 +1,79 @@
+#include "mt-kahypar/definitions.h"
+#include "mt-kahypar/io/hypergraph_io.h"
+#include "mt-kahypar/partition/refinement/fm/strategies/km1_gains.h"
+
+#include <tbb/task_arena.h>
+
+#include <chrono>
+#include <iostream>
+#include <random>
+
+namespace mt_kahypar {
+
+// Computes the best target block of every node of a random bisection once with the
+// general k-way gain computation (connectivity set scans) and once with the 2-way
+// specialization (pin counts of both blocks only).
+template<typename F>
+double timeGainComputations(const PartitionedHypergraph& phg, size_t num_rounds, F compute_target,
+                            vec<std::pair<PartitionID, HyperedgeWeight>>& result) {
+  auto start = std::chrono::high_resolution_clock::now();
+  for (size_t round = 0; round < num_rounds; ++round) {
+    for (const HypernodeID& u : phg.nodes()) {
+      result[u] = compute_target(u);
+    }
+  }
+  auto end = std::chrono::high_resolution_clock::now();
+  return std::chrono::duration<double>(end - start).count();
+}
+
+bool benchBisectionGains(Hypergraph& hypergraph, const double epsilon, size_t num_rounds) {
+  PartitionedHypergraph phg(2, hypergraph, parallel_tag_t());
+  std::mt19937 rng(420);
+  std::uniform_int_distribution<PartitionID> block_dist(0, 1);
+  for (const HypernodeID& u : hypergraph.nodes()) {
+    phg.setOnlyNodePart(u, block_dist(rng));
+  }
+  phg.initializePartition();
+  const HypernodeWeight max_part_weight = (1.0 + epsilon) * std::ceil(hypergraph.totalWeight() / 2.0);
+  const std::vector<HypernodeWeight> max_part_weights(2, max_part_weight);
+
+  Km1GainComputer gc(2);
+  vec<std::pair<PartitionID, HyperedgeWeight>> kway_result(hypergraph.initialNumNodes());
+  vec<std::pair<PartitionID, HyperedgeWeight>> two_way_result(hypergraph.initialNumNodes());
+  const double kway_time = timeGainComputations(phg, num_rounds, [&](const HypernodeID u) {
+    return gc.computeBestTargetBlockKWay(phg, u, max_part_weights);
+  }, kway_result);
+  const double two_way_time = timeGainComputations(phg, num_rounds, [&](const HypernodeID u) {
+    return gc.computeBestTargetBlockTwoWay(phg, u, max_part_weights);
+  }, two_way_result);
+
+  bool equal = true;
+  for (const HypernodeID& u : hypergraph.nodes()) {
+    equal &= kway_result[u].first == two_way_result[u].first &&
+      (kway_result[u].first == kInvalidPartition || kway_result[u].second == two_way_result[u].second);
+  }
+  std::cout << "k-way=" << kway_time << "s"
+            << " 2-way=" << two_way_time << "s"
+            << " speedup=" << (kway_time / two_way_time)
+            << (equal ? "" : " RESULTS DIFFER") << std::endl;
+  return equal;
+}
+
+}
+
+
+int main(int argc, char* argv[]) {
+
+  if (argc != 3) {
+    std::cout << "Usage. hypergraph-file num-rounds" << std::endl;
+    std::exit(0);
+  }
+
+  const size_t num_rounds = std::stoul(argv[2]);
+  tbb::task_arena arena(1);
+  const bool equal = arena.execute([&] {
+    mt_kahypar::Hypergraph hypergraph = mt_kahypar::io::readHypergraphFile(argv[1]);
+    return mt_kahypar::benchBisectionGains(hypergraph, 0.03, num_rounds);
+  });
+  return equal ? 0 : 1;
+}
@@ -0,0 +1,131 @@
+#include "mt-kahypar/datastructures/pin_count_in_part.h"
+#include "mt-kahypar/parallel/atomic_wrapper.h"
+#include "mt-kahypar/parallel/stl/scalable_vector.h"
+
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <numeric>
+#include <random>
+
+namespace mt_kahypar::ds {
+
+// Hypergraph with power-law distributed net sizes and node degrees.
+// Only the incident nets of the nodes are required to simulate the pin count updates.
+struct Instance {
+  HyperedgeID num_nets = 0;
+  HypernodeID max_net_size = 0;
+  vec<vec<HyperedgeID>> incident_nets;
+  vec<PartitionID> part;
+};
+
+Instance generateInstance(HypernodeID num_nodes, HyperedgeID num_nets, PartitionID k, std::mt19937& rng) {
+  std::uniform_real_distribution<double> uniform(0.0, 1.0);
+  std::uniform_int_distribution<PartitionID> block_dist(0, k - 1);
+  Instance instance;
+  instance.num_nets = num_nets;
+  instance.incident_nets.resize(num_nodes);
+  vec<HypernodeID> net_sizes(num_nets, 0);
+  for (HyperedgeID e = 0; e < num_nets; ++e) {
+    // pareto distributed net size with exponent 2 and minimum size 2
+    const HypernodeID size = std::min(num_nodes, static_cast<HypernodeID>(2.0 / std::sqrt(1.0 - uniform(rng))));
+    for (HypernodeID i = 0; i < size; ++i) {
+      // low node IDs are chosen more often => power-law node degrees
+      const HypernodeID u = std::min(num_nodes - 1, static_cast<HypernodeID>(num_nodes * std::pow(uniform(rng), 3.0)));
+      instance.incident_nets[u].push_back(e);
+    }
+    net_sizes[e] = size;
+  }
+  instance.max_net_size = *std::max_element(net_sizes.begin(), net_sizes.end());
+  for (HypernodeID u = 0; u < num_nodes; ++u) {
+    instance.part.push_back(block_dist(rng));
+  }
+  return instance;
+}
+
+void initializePinCounts(const Instance& instance, PinCountInPart& pin_counts) {
+  pin_counts.data().assign(pin_counts.data().size(), 0);
+  for (HypernodeID u = 0; u < instance.incident_nets.size(); ++u) {
+    for (const HyperedgeID e : instance.incident_nets[u]) {
+      pin_counts.incrementPinCountInPart(e, instance.part[u]);
+    }
+  }
+}
+
+// Each node is moved num_rounds times to the next block. The moves of a round are performed in parallel.
+template<typename F>
+double timeMoves(const Instance& instance, PartitionID k, size_t num_rounds, PinCountInPart& pin_counts, F move_pin) {
+  initializePinCounts(instance, pin_counts);
+  vec<PartitionID> part = instance.part;
+  auto start = std::chrono::high_resolution_clock::now();
+  for (size_t round = 0; round < num_rounds; ++round) {
+    tbb::parallel_for(HypernodeID(0), static_cast<HypernodeID>(part.size()), [&](const HypernodeID u) {
+      const PartitionID from = part[u];
+      const PartitionID to = (from + 1) % k;
+      for (const HyperedgeID e : instance.incident_nets[u]) {
+        move_pin(e, from, to);
+      }
+      part[u] = to;
+    });
+  }
+  auto end = std::chrono::high_resolution_clock::now();
+  return std::chrono::duration<double>(end - start).count();
+}
+
+bool benchPinCountUpdates(const Instance& instance, PartitionID k, size_t num_rounds) {
+  PinCountInPart locked_pin_counts(instance.num_nets, k, instance.max_net_size);
+  PinCountInPart atomic_pin_counts(instance.num_nets, k, instance.max_net_size);
+  vec<SpinLock> ownership(instance.num_nets);
+  const double locked_time = timeMoves(instance, k, num_rounds, locked_pin_counts,
+    [&](const HyperedgeID e, const PartitionID from, const PartitionID to) {
+      ownership[e].lock();
+      locked_pin_counts.decrementPinCountInPart(e, from);
+      locked_pin_counts.incrementPinCountInPart(e, to);
+      ownership[e].unlock();
+    });
+  const double atomic_time = timeMoves(instance, k, num_rounds, atomic_pin_counts,
+    [&](const HyperedgeID e, const PartitionID from, const PartitionID to) {
+      HypernodeID pin_count_in_from_part_after = 0;
+      HypernodeID pin_count_in_to_part_after = 0;
+      atomic_pin_counts.movePinAtomically(e, from, to,
+        pin_count_in_from_part_after, pin_count_in_to_part_after);
+    });
+  const bool equal = locked_pin_counts.data().size() == atomic_pin_counts.data().size() &&
+    std::equal(locked_pin_counts.data().begin(), locked_pin_counts.data().end(), atomic_pin_counts.data().begin());
+  std::cout << "k=" << k
+            << " locked=" << locked_time << "s"
+            << " atomic=" << atomic_time << "s"
+            << " speedup=" << (locked_time / atomic_time)
+            << (equal ? "" : " RESULTS DIFFER") << std::endl;
+  return equal;
+}
+
+}
+
+
+int main(int argc, char* argv[]) {
+
+  if (argc != 5) {
+    std::cout << "Usage. num-threads num-nodes num-nets num-rounds" << std::endl;
+    std::exit(0);
+  }
+
+  const int num_threads = std::stoi(argv[1]);
+  const mt_kahypar::HypernodeID num_nodes = std::stoul(argv[2]);
+  const mt_kahypar::HyperedgeID num_nets = std::stoul(argv[3]);
+  const size_t num_rounds = std::stoul(argv[4]);
+  std::mt19937 rng(420);
+  tbb::task_arena arena(num_threads);
+  bool all_equal = true;
+  for (mt_kahypar::PartitionID k : { 2, 8, 32, 128 }) {
+    const mt_kahypar::ds::Instance instance = mt_kahypar::ds::generateInstance(num_nodes, num_nets, k, rng);
+    arena.execute([&] {
+      all_equal &= mt_kahypar::ds::benchPinCountUpdates(instance, k, num_rounds);
+    });
+  }
+  return all_equal ? 0 : 1;
+}
@@ -0,0 +1,100 @@
+#include "mt-kahypar/partition/coarsening/rating_accumulation.h"
+#include "mt-kahypar/parallel/stl/scalable_vector.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <random>
+
+namespace mt_kahypar::rating_accumulation {
+
+// Simulates the rating of a node with num_nets incident nets of size net_size:
+// each distinct cluster ID of a net receives the score of the net (deduplicated with a bloom filter).
+struct Instance {
+  size_t net_size = 0;
+  vec<HypernodeID> pins;
+  vec<HypernodeID> cluster_ids;
+};
+
+Instance generateInstance(HypernodeID num_nodes, size_t num_nets, size_t net_size, std::mt19937& rng) {
+  std::uniform_int_distribution<HypernodeID> node_dist(0, num_nodes - 1);
+  Instance instance;
+  instance.net_size = net_size;
+  for (size_t i = 0; i < num_nets * net_size; ++i) {
+    instance.pins.push_back(node_dist(rng));
+  }
+  // half of the nodes are already clustered
+  for (HypernodeID u = 0; u < num_nodes; ++u) {
+    instance.cluster_ids.push_back(u % 2 == 0 ? u : node_dist(rng));
+  }
+  return instance;
+}
+
+template<typename Gather>
+double timeAccumulation(const Instance& instance, size_t num_rounds, vec<double>& ratings, Gather gather_batch) {
+  const size_t bloom_filter_mask = 1023;
+  vec<bool> bloom_filter(bloom_filter_mask + 1, false);
+  HypernodeID representatives[kBatchSize];
+  ratings.assign(instance.cluster_ids.size(), 0.0);
+  auto start = std::chrono::high_resolution_clock::now();
+  for (size_t round = 0; round < num_rounds; ++round) {
+    for (size_t first = 0; first < instance.pins.size(); first += instance.net_size) {
+      const double score = 1.0 / (instance.net_size - 1);
+      for (size_t i = 0; i < instance.net_size; i += kBatchSize) {
+        const size_t batch_size = std::min(kBatchSize, instance.net_size - i);
+        gather_batch(instance.pins.data() + first + i, batch_size, instance.cluster_ids.data(), representatives);
+        for (size_t j = 0; j < batch_size; ++j) {
+          const HypernodeID representative = representatives[j];
+          if (!bloom_filter[representative & bloom_filter_mask]) {
+            ratings[representative] += score;
+            bloom_filter[representative & bloom_filter_mask] = true;
+          }
+        }
+      }
+      std::fill(bloom_filter.begin(), bloom_filter.end(), false);
+    }
+  }
+  auto end = std::chrono::high_resolution_clock::now();
+  return std::chrono::duration<double>(end - start).count();
+}
+
+bool benchRatingAccumulation(const Instance& instance, size_t num_rounds) {
+  vec<double> scalar_ratings;
+  vec<double> simd_ratings;
+  const double scalar_time = timeAccumulation(instance, num_rounds, scalar_ratings, gatherScalar);
+  const double simd_time = timeAccumulation(instance, num_rounds, simd_ratings, gather);
+  const bool equal = scalar_ratings == simd_ratings;
+  std::cout << "net_size=" << instance.net_size
+            << " scalar=" << scalar_time << "s"
+            << " simd=" << simd_time << "s"
+            << " speedup=" << (scalar_time / simd_time)
+            << (equal ? "" : " RESULTS DIFFER") << std::endl;
+  return equal;
+}
+
+}
+
+
+int main(int argc, char* argv[]) {
+
+  if (argc != 4) {
+    std::cout << "Usage. num-nodes num-pins num-rounds" << std::endl;
+    std::exit(0);
+  }
+
+  const mt_kahypar::HypernodeID num_nodes = std::stoul(argv[1]);
+  const size_t num_pins = std::stoul(argv[2]);
+  const size_t num_rounds = std::stoul(argv[3]);
+  if (!mt_kahypar::rating_accumulation::canUseVectorizedGather(num_nodes)) {
+    std::cout << "Vectorized gather is not supported for " << num_nodes << " nodes" << std::endl;
+    std::exit(0);
+  }
+  std::mt19937 rng(420);
+  bool all_equal = true;
+  for (size_t net_size : { 2, 8, 32, 128, 512, 1000 }) {
+    const mt_kahypar::rating_accumulation::Instance instance =
+      mt_kahypar::rating_accumulation::generateInstance(num_nodes, std::max(num_pins / net_size, 1UL), net_size, rng);
+    all_equal &= mt_kahypar::rating_accumulation::benchRatingAccumulation(instance, num_rounds);
+  }
+  return all_equal ? 0 : 1;
+}
@@ -0,0 +1,81 @@
+#include "mt-kahypar/partition/refinement/fm/strategies/target_block_selection.h"
+
+#include <chrono>
+#include <iostream>
+#include <random>
+
+namespace mt_kahypar::target_block_selection {
+
+struct Instance {
+  vec<Gain> benefits;
+  vec<HypernodeWeight> weights;
+  vec<HypernodeWeight> max_weights;
+  vec<PartitionID> from;
+  vec<HypernodeWeight> node_weights;
+};
+
+Instance generateInstance(PartitionID k, size_t num_queries, std::mt19937& rng) {
+  // small value ranges to provoke many ties and infeasible blocks
+  std::uniform_int_distribution<Gain> benefit_dist(0, 8);
+  std::uniform_int_distribution<HypernodeWeight> weight_dist(90, 110);
+  std::uniform_int_distribution<HypernodeWeight> node_weight_dist(1, 5);
+  std::uniform_int_distribution<PartitionID> block_dist(0, k - 1);
+
+  Instance instance;
+  for (PartitionID i = 0; i < k; ++i) {
+    instance.max_weights.push_back(110);
+  }
+  for (size_t q = 0; q < num_queries; ++q) {
+    for (PartitionID i = 0; i < k; ++i) {
+      instance.benefits.push_back(benefit_dist(rng));
+      instance.weights.push_back(weight_dist(rng));
+    }
+    instance.from.push_back(block_dist(rng));
+    instance.node_weights.push_back(node_weight_dist(rng));
+  }
+  return instance;
+}
+
+template<typename F>
+double timeQueries(const Instance& instance, PartitionID k, F select_target, vec<PartitionID>& result) {
+  auto start = std::chrono::high_resolution_clock::now();
+  for (size_t q = 0; q < instance.from.size(); ++q) {
+    result[q] = select_target(instance.benefits.data() + q * k, instance.weights.data() + q * k,
+                              instance.max_weights.data(), k, instance.from[q], instance.node_weights[q]);
+  }
+  auto end = std::chrono::high_resolution_clock::now();
+  return std::chrono::duration<double>(end - start).count();
+}
+
+bool benchTargetBlockSelection(PartitionID k, size_t num_queries, std::mt19937& rng) {
+  Instance instance = generateInstance(k, num_queries, rng);
+  vec<PartitionID> scalar_result(num_queries), simd_result(num_queries);
+  const double scalar_time = timeQueries(instance, k, selectScalar, scalar_result);
+  const double simd_time = timeQueries(instance, k, select, simd_result);
+  const bool equal = scalar_result == simd_result;
+  std::cout << "k=" << k
+            << " scalar=" << scalar_time << "s"
+            << " simd=" << simd_time << "s"
+            << " speedup=" << (scalar_time / simd_time)
+            << (equal ? "" : " RESULTS DIFFER") << std::endl;
+  return equal;
+}
+
+}
+
+
+int main(int argc, char* argv[]) {
+
+  if (argc != 2) {
+    std::cout << "Usage. num-queries" << std::endl;
+    std::exit(0);
+  }
+
+  const size_t num_queries = std::stoul(argv[1]);
+  std::mt19937 rng(420);
+  bool all_equal = true;
+  for (mt_kahypar::PartitionID k = 2; k <= mt_kahypar::target_block_selection::kMaxVectorizedBlocks; ++k) {
+    all_equal &= mt_kahypar::target_block_selection::benchTargetBlockSelection(k, num_queries, rng);
+  }
+  return all_equal ? 0 : 1;
+}